@@ -1,17 +1,51 @@
 // Copyright 2020-2023, Roberto De Ioris.
 
 #include "glTFRuntime.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/QueuedThreadPool.h"
 
 #define LOCTEXT_NAMESPACE "FglTFRuntimeModule"
 
+static TAutoConsoleVariable<int32> CVarglTFRuntimeWorkerThreads(
+	TEXT("glTFRuntime.WorkerThreads"),
+	0,
+	TEXT("Number of threads used for async glTF loading (0 = number of worker threads of the platform). Read at module startup."),
+	ECVF_ReadOnly);
+
+static FQueuedThreadPool* glTFRuntimeWorkerPool = nullptr;
+
 void FglTFRuntimeModule::StartupModule()
 {
+	int32 NumThreads = CVarglTFRuntimeWorkerThreads.GetValueOnAnyThread();
+	if (NumThreads <= 0)
+	{
+		NumThreads = FMath::Max(FPlatformMisc::NumberOfWorkerThreadsToSpawn(), 1);
+	}
+
+	glTFRuntimeWorkerPool = FQueuedThreadPool::Allocate();
+	// mesh building can use deep call stacks, so do not use the default (small) pool stack size
+	if (!glTFRuntimeWorkerPool->Create(NumThreads, 1024 * 1024, TPri_BelowNormal, TEXT("glTFRuntimeWorkerPool")))
+	{
+		delete glTFRuntimeWorkerPool;
+		glTFRuntimeWorkerPool = nullptr;
+	}
 }
 
 void FglTFRuntimeModule::ShutdownModule()
 {
+	if (glTFRuntimeWorkerPool)
+	{
+		glTFRuntimeWorkerPool->Destroy();
+		delete glTFRuntimeWorkerPool;
+		glTFRuntimeWorkerPool = nullptr;
+	}
+}
+
+FQueuedThreadPool* FglTFRuntimeModule::GetWorkerPool()
+{
+	return glTFRuntimeWorkerPool;
 }
 
 #undef LOCTEXT_NAMESPACE
 	
-IMPLEMENT_MODULE(FglTFRuntimeModule, glTFRuntime)
\ No newline at end of file
+IMPLEMENT_MODULE(FglTFRuntimeModule, glTFRuntime)
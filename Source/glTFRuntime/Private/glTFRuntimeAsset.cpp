@@ -86,6 +86,13 @@ bool UglTFRuntimeAsset::LoadFromString(const FString& JsonData, const FglTFRunti
 	return Parser != nullptr;
 }
 
+bool UglTFRuntimeAsset::UpdateFromString(const FString& JsonData, const TMap<FString, FBinaryData>& ChangedAux, FglTFRuntimeSceneUpdate& SceneUpdate)
+{
+	GLTF_CHECK_PARSER(false);
+
+	return Parser->UpdateFromString(JsonData, ChangedAux, SceneUpdate);
+}
+
 bool UglTFRuntimeAsset::LoadFromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig)
 {
 	// asset already loaded ?
@@ -640,6 +647,10 @@ UTexture2D* UglTFRuntimeAsset::LoadImage(const int32 ImageIndex, const FglTFRunt
 		Mip.Height = Height;
 		Mip.PixelFormat = PixelFormat;
 		TArray<FglTFRuntimeMipMap> Mips = { Mip };
+		if (ImagesConfig.bCompressMips)
+		{
+			FglTFRuntimeTextureCompressor::CompressMips(Mips, ImagesConfig.Compression == TextureCompressionSettings::TC_Normalmap);
+		}
 		return Parser->BuildTexture(this, Mips, ImagesConfig, FglTFRuntimeTextureSampler());
 	}
 
@@ -776,6 +787,10 @@ UTexture2D* UglTFRuntimeAsset::LoadImageFromBlob(const FglTFRuntimeImagesConfig&
 		Mip.Height = Height;
 		Mip.PixelFormat = PixelFormat;
 		TArray<FglTFRuntimeMipMap> Mips = { Mip };
+		if (ImagesConfig.bCompressMips)
+		{
+			FglTFRuntimeTextureCompressor::CompressMips(Mips, ImagesConfig.Compression == TextureCompressionSettings::TC_Normalmap);
+		}
 		return Parser->BuildTexture(this, Mips, ImagesConfig, FglTFRuntimeTextureSampler());
 	}
 
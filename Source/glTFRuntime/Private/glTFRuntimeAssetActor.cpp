@@ -8,6 +8,8 @@
 #include "Engine/StaticMeshSocket.h"
 #include "Animation/AnimSequence.h"
 #include "glTFRuntimeSkeletalMeshComponent.h"
+#include "glTFRuntimeLinesComponent.h"
+#include "glTFRuntimePointCloudComponent.h"
 
 // Sets default values
 AglTFRuntimeAssetActor::AglTFRuntimeAssetActor()
@@ -84,6 +86,9 @@ void AglTFRuntimeAssetActor::BeginPlay()
 		}
 	}
 
+	// the load pass is over, mips prefetched for materials that were never loaded are not required anymore
+	Asset->GetParser()->ReleasePrefetchedTextures();
+
 	UE_LOG(LogGLTFRuntime, Log, TEXT("Asset loaded in %f seconds"), FPlatformTime::Seconds() - LoadingStartTime);
 }
 
@@ -167,41 +172,7 @@ void AglTFRuntimeAssetActor::ProcessNode(USceneComponent* NodeParentComponent, c
 				StaticMeshComponent->SetupAttachment(NodeParentComponent);
 			}
 
-			TArray<int32> MeshIndices;
-			MeshIndices.Add(Node.MeshIndex);
-
-			TArray<int32> LODNodeIndices;
-			if (Asset->GetNodeExtensionIndices(Node.Index, "MSFT_lod", "ids", LODNodeIndices))
-			{
-				for (const int32 LODNodeIndex : LODNodeIndices)
-				{
-					FglTFRuntimeNode LODNode;
-					// stop the chain at the first invalid node/mesh
-					if (!Asset->GetNode(LODNodeIndex, LODNode))
-					{
-						break;
-					}
-					if (LODNode.MeshIndex <= INDEX_NONE)
-					{
-						break;
-					}
-					MeshIndices.Add(LODNode.MeshIndex);
-				}
-			}
-
-			if (MeshIndices.Num() > 1)
-			{
-				TArray<float> ScreenCoverages;
-				if (Asset->GetNodeExtrasNumbers(Node.Index, "MSFT_screencoverage", ScreenCoverages))
-				{
-					for (int32 SCIndex = 0; SCIndex < ScreenCoverages.Num(); SCIndex++)
-					{
-						StaticMeshConfig.LODScreenSize.Add(SCIndex, ScreenCoverages[SCIndex]);
-					}
-				}
-			}
-
-			UStaticMesh* StaticMesh = Asset->LoadStaticMeshLODs(MeshIndices, StaticMeshConfig, StaticMeshComponent);
+			UStaticMesh* StaticMesh = LoadNodeStaticMesh(Node, StaticMeshComponent);
 			if (StaticMesh && !StaticMeshConfig.ExportOriginalPivotToSocket.IsEmpty())
 			{
 				UStaticMeshSocket* DeltaSocket = StaticMesh->FindSocket(FName(StaticMeshConfig.ExportOriginalPivotToSocket));
@@ -269,6 +240,9 @@ void AglTFRuntimeAssetActor::ProcessNode(USceneComponent* NodeParentComponent, c
 	}
 	else
 	{
+		NodeComponents.Add(Node.Index, NewComponent);
+		NodeMeshIndices.Add(Node.Index, Node.MeshIndex);
+
 		NewComponent->ComponentTags.Add(*FString::Printf(TEXT("GLTFRuntime:NodeName:%s"), *Node.Name));
 		NewComponent->ComponentTags.Add(*FString::Printf(TEXT("GLTFRuntime:NodeIndex:%d"), Node.Index));
 
@@ -376,6 +350,183 @@ void AglTFRuntimeAssetActor::ProcessNode(USceneComponent* NodeParentComponent, c
 	}
 }
 
+UStaticMesh* AglTFRuntimeAssetActor::LoadNodeStaticMesh(const FglTFRuntimeNode& Node, UStaticMeshComponent*& StaticMeshComponent)
+{
+	TArray<int32> MeshIndices;
+	MeshIndices.Add(Node.MeshIndex);
+
+	TArray<int32> LODNodeIndices;
+	if (Asset->GetNodeExtensionIndices(Node.Index, "MSFT_lod", "ids", LODNodeIndices))
+	{
+		for (const int32 LODNodeIndex : LODNodeIndices)
+		{
+			FglTFRuntimeNode LODNode;
+			// stop the chain at the first invalid node/mesh
+			if (!Asset->GetNode(LODNodeIndex, LODNode))
+			{
+				break;
+			}
+			if (LODNode.MeshIndex <= INDEX_NONE)
+			{
+				break;
+			}
+			MeshIndices.Add(LODNode.MeshIndex);
+		}
+	}
+
+	if (MeshIndices.Num() > 1)
+	{
+		TArray<float> ScreenCoverages;
+		if (Asset->GetNodeExtrasNumbers(Node.Index, "MSFT_screencoverage", ScreenCoverages))
+		{
+			for (int32 SCIndex = 0; SCIndex < ScreenCoverages.Num(); SCIndex++)
+			{
+				StaticMeshConfig.LODScreenSize.Add(SCIndex, ScreenCoverages[SCIndex]);
+			}
+		}
+	}
+
+	return Asset->LoadStaticMeshLODs(MeshIndices, StaticMeshConfig, StaticMeshComponent);
+}
+
+bool AglTFRuntimeAssetActor::UpdateFromString(const FString& JsonData, const TMap<FString, FBinaryData>& ChangedAux)
+{
+	if (!Asset || !Asset->GetParser())
+	{
+		return false;
+	}
+
+	// the parser switches to the new revision only after the actor validated it
+	TSharedRef<FglTFRuntimeParser> Parser = Asset->GetParser().ToSharedRef();
+
+	FglTFRuntimeSceneUpdate SceneUpdate;
+	FglTFRuntimePendingUpdate PendingUpdate;
+	if (!Parser->DiffFromString(JsonData, ChangedAux, SceneUpdate, PendingUpdate))
+	{
+		return false;
+	}
+
+	if (SceneUpdate.bStructureChanged)
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("glTF hierarchy changed, the asset needs a full reload"));
+		return false;
+	}
+
+	const TSet<int32> DirtyMeshes(SceneUpdate.DirtyMeshes);
+	TSet<int32> DirtyNodes(SceneUpdate.DirtyNodes);
+
+	// nodes are untouched but their mesh has to be rebuilt
+	for (const TPair<int32, int32>& Pair : NodeMeshIndices)
+	{
+		if (DirtyMeshes.Contains(Pair.Value))
+		{
+			DirtyNodes.Add(Pair.Key);
+		}
+	}
+
+	// validate every node before touching the parser and the components, a failed update leaves both as they were
+	TArray<TPair<int32, USceneComponent*>> NodesToUpdate;
+	for (const int32 NodeIndex : DirtyNodes)
+	{
+		int32 MeshIndex;
+		if (!PendingUpdate.GetNodeMeshIndex(NodeIndex, MeshIndex))
+		{
+			return false;
+		}
+
+		// bones have no component
+		USceneComponent* Component = NodeComponents.FindRef(NodeIndex).Get();
+		if (!Component && Asset->NodeIsBone(NodeIndex))
+		{
+			continue;
+		}
+
+		// a node gaining or losing its mesh requires a different component
+		if (!Component || (NodeMeshIndices.FindRef(NodeIndex) > INDEX_NONE) != (MeshIndex > INDEX_NONE))
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("glTF node %d cannot be updated, the asset needs a full reload"), NodeIndex);
+			return false;
+		}
+
+		NodesToUpdate.Add(TPair<int32, USceneComponent*>(NodeIndex, Component));
+	}
+
+	Parser->ApplyUpdate(PendingUpdate);
+
+	for (const TPair<int32, USceneComponent*>& Pair : NodesToUpdate)
+	{
+		FglTFRuntimeNode Node;
+		if (!Asset->GetNode(Pair.Key, Node))
+		{
+			continue;
+		}
+
+		const int32 OldMeshIndex = NodeMeshIndices.FindRef(Node.Index);
+		UpdateNode(Node, Pair.Value, DirtyMeshes.Contains(OldMeshIndex) || OldMeshIndex != Node.MeshIndex);
+	}
+
+	Parser->ReleasePrefetchedTextures();
+
+	return true;
+}
+
+void AglTFRuntimeAssetActor::UpdateNode(const FglTFRuntimeNode& Node, USceneComponent* Component, const bool bMeshChanged)
+{
+	const int32 NodeIndex = Node.Index;
+	if (bMeshChanged)
+	{
+		if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component))
+		{
+			// points and lines primitives reuse the helper components attached to the mesh component
+			UStaticMeshComponent* NewStaticMeshComponent = StaticMeshComponent;
+			UStaticMesh* StaticMesh = LoadNodeStaticMesh(Node, NewStaticMeshComponent);
+
+			// a real mesh (or glyphs) does not need them anymore
+			TArray<USceneComponent*> Children;
+			if (StaticMesh)
+			{
+				StaticMeshComponent->GetChildrenComponents(false, Children);
+				for (USceneComponent* Child : Children)
+				{
+					if (Child->IsA<UglTFRuntimeLinesComponent>() || Child->IsA<UglTFRuntimePointCloudComponent>())
+					{
+						Child->DestroyComponent();
+					}
+				}
+			}
+
+			// glyphs replace the mesh component with an instanced one
+			if (NewStaticMeshComponent != StaticMeshComponent)
+			{
+				NewStaticMeshComponent->SetupAttachment(StaticMeshComponent->GetAttachParent());
+				NewStaticMeshComponent->RegisterComponent();
+				NewStaticMeshComponent->ComponentTags = StaticMeshComponent->ComponentTags;
+				AddInstanceComponent(NewStaticMeshComponent);
+
+				StaticMeshComponent->GetChildrenComponents(false, Children);
+				for (USceneComponent* Child : Children)
+				{
+					Child->AttachToComponent(NewStaticMeshComponent, FAttachmentTransformRules::KeepRelativeTransform);
+				}
+				StaticMeshComponent->DestroyComponent();
+
+				NodeComponents.Add(NodeIndex, NewStaticMeshComponent);
+				Component = NewStaticMeshComponent;
+			}
+
+			NewStaticMeshComponent->SetStaticMesh(StaticMesh);
+		}
+		else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(Component))
+		{
+			SkeletalMeshComponent->SetSkeletalMesh(Asset->LoadSkeletalMesh(Node.MeshIndex, Node.SkinIndex, SkeletalMeshConfig));
+		}
+
+		NodeMeshIndices.Add(NodeIndex, Node.MeshIndex);
+	}
+
+	Component->SetRelativeTransform(Node.Transform);
+}
+
 void AglTFRuntimeAssetActor::SetCurveAnimationByName(const FString& CurveAnimationName)
 {
 	if (!DiscoveredCurveAnimationsNames.Contains(CurveAnimationName))
@@ -17,6 +17,7 @@ AglTFRuntimeAssetActorAsync::AglTFRuntimeAssetActorAsync()
 
 	bShowWhileLoading = true;
 	bStaticMeshesAsSkeletal = false;
+	MaxConcurrentMeshes = 4;
 }
 
 // Called when the game starts or when spawned
@@ -130,35 +131,45 @@ void AglTFRuntimeAssetActorAsync::ProcessNode(USceneComponent* NodeParentCompone
 
 void AglTFRuntimeAssetActorAsync::LoadNextMeshAsync()
 {
-	if (MeshesToLoad.Num() == 0)
+	// cached meshes complete synchronously, so the request is always removed from the queue before starting it
+	while (MeshesToLoad.Num() > 0 && MeshRequestsInFlight.Num() < FMath::Max(MaxConcurrentMeshes, 1))
 	{
-		return;
-	}
+		auto It = MeshesToLoad.CreateIterator();
+		UPrimitiveComponent* PrimitiveComponent = It->Key;
+		const FglTFRuntimeNode Node = It->Value;
+		It.RemoveCurrent();
 
-	auto It = MeshesToLoad.CreateIterator();
-	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(It->Key))
-	{
-		CurrentPrimitiveComponent = StaticMeshComponent;
-		if (StaticMeshConfig.Outer == nullptr)
+		UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest = NewObject<UglTFRuntimeAssetActorAsyncMeshRequest>(this);
+		MeshRequest->PrimitiveComponent = PrimitiveComponent;
+		MeshRequest->Owner = this;
+		MeshRequestsInFlight.Add(MeshRequest);
+
+		if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(PrimitiveComponent))
+		{
+			if (StaticMeshConfig.Outer == nullptr)
+			{
+				StaticMeshConfig.Outer = StaticMeshComponent;
+			}
+			FglTFRuntimeStaticMeshAsync Delegate;
+			Delegate.BindDynamic(MeshRequest, &UglTFRuntimeAssetActorAsyncMeshRequest::OnStaticMeshLoaded);
+			Asset->LoadStaticMeshAsync(Node.MeshIndex, Delegate, StaticMeshConfig);
+		}
+		else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(PrimitiveComponent))
 		{
-			StaticMeshConfig.Outer = StaticMeshComponent;
+			FglTFRuntimeSkeletalMeshAsync Delegate;
+			Delegate.BindDynamic(MeshRequest, &UglTFRuntimeAssetActorAsyncMeshRequest::OnSkeletalMeshLoaded);
+			Asset->LoadSkeletalMeshAsync(Node.MeshIndex, Node.SkinIndex, Delegate, SkeletalMeshConfig);
+		}
+		else
+		{
+			MeshRequestCompleted(MeshRequest);
 		}
-		FglTFRuntimeStaticMeshAsync Delegate;
-		Delegate.BindDynamic(this, &AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync);
-		Asset->LoadStaticMeshAsync(It->Value.MeshIndex, Delegate, StaticMeshConfig);
-	}
-	else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(It->Key))
-	{
-		CurrentPrimitiveComponent = SkeletalMeshComponent;
-		FglTFRuntimeSkeletalMeshAsync Delegate;
-		Delegate.BindDynamic(this, &AglTFRuntimeAssetActorAsync::LoadSkeletalMeshAsync);
-		Asset->LoadSkeletalMeshAsync(It->Value.MeshIndex, It->Value.SkinIndex, Delegate, SkeletalMeshConfig);
 	}
 }
 
-void AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync(UStaticMesh* StaticMesh)
+void AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest, UStaticMesh* StaticMesh)
 {
-	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(CurrentPrimitiveComponent))
+	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshRequest->PrimitiveComponent))
 	{
 		DiscoveredStaticMeshComponents.Add(StaticMeshComponent, StaticMesh);
 		if (bShowWhileLoading)
@@ -181,21 +192,12 @@ void AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync(UStaticMesh* StaticMesh)
 
 	}
 
-	MeshesToLoad.Remove(CurrentPrimitiveComponent);
-	if (MeshesToLoad.Num() > 0)
-	{
-		LoadNextMeshAsync();
-	}
-	// trigger event
-	else
-	{
-		ScenesLoaded();
-	}
+	MeshRequestCompleted(MeshRequest);
 }
 
-void AglTFRuntimeAssetActorAsync::LoadSkeletalMeshAsync(USkeletalMesh* SkeletalMesh)
+void AglTFRuntimeAssetActorAsync::LoadSkeletalMeshAsync(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest, USkeletalMesh* SkeletalMesh)
 {
-	if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(CurrentPrimitiveComponent))
+	if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(MeshRequest->PrimitiveComponent))
 	{
 		DiscoveredSkeletalMeshComponents.Add(SkeletalMeshComponent, SkeletalMesh);
 		if (bShowWhileLoading)
@@ -204,13 +206,19 @@ void AglTFRuntimeAssetActorAsync::LoadSkeletalMeshAsync(USkeletalMesh* SkeletalM
 		}
 	}
 
-	MeshesToLoad.Remove(CurrentPrimitiveComponent);
+	MeshRequestCompleted(MeshRequest);
+}
+
+void AglTFRuntimeAssetActorAsync::MeshRequestCompleted(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest)
+{
+	MeshRequestsInFlight.Remove(MeshRequest);
+
 	if (MeshesToLoad.Num() > 0)
 	{
 		LoadNextMeshAsync();
 	}
 	// trigger event
-	else
+	else if (MeshRequestsInFlight.Num() == 0)
 	{
 		ScenesLoaded();
 	}
@@ -262,3 +270,19 @@ void AglTFRuntimeAssetActorAsync::PostUnregisterAllComponents()
 	}
 	Super::PostUnregisterAllComponents();
 }
+
+void UglTFRuntimeAssetActorAsyncMeshRequest::OnStaticMeshLoaded(UStaticMesh* StaticMesh)
+{
+	if (Owner.IsValid())
+	{
+		Owner->LoadStaticMeshAsync(this, StaticMesh);
+	}
+}
+
+void UglTFRuntimeAssetActorAsyncMeshRequest::OnSkeletalMeshLoaded(USkeletalMesh* SkeletalMesh)
+{
+	if (Owner.IsValid())
+	{
+		Owner->LoadSkeletalMeshAsync(this, SkeletalMesh);
+	}
+}
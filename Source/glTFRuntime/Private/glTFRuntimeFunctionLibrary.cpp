@@ -56,12 +56,13 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsync(const FString&
 		OverrideConfig.bSearchContentDir = true;
 	}
 
-	Async(EAsyncExecution::Thread, [Filename, Asset, Completed, OverrideConfig]()
+	// parsing gates every other request on the asset, so it goes before mesh building
+	FglTFRuntimeParser::RunOnWorkerPool([Filename, Asset, Completed, OverrideConfig]()
 		{
 			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromFilename(Filename, OverrideConfig);
 
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
+			FglTFRuntimeParser::RunOnGameThread([Parser, Asset, Completed]()
 				{
 					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
@@ -71,9 +72,8 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsync(const FString&
 					{
 						Completed.ExecuteIfBound(nullptr);
 					}
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+				});
+		}, EglTFRuntimeAsyncPriority::High);
 }
 
 UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromString(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig)
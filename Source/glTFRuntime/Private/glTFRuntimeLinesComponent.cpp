@@ -0,0 +1,170 @@
+// Copyright 2023, Roberto De Ioris.
+
+#include "glTFRuntimeLinesComponent.h"
+#include "DynamicMeshBuilder.h"
+#include "Engine/Engine.h"
+#include "LocalVertexFactory.h"
+#include "MaterialShared.h"
+#include "Materials/Material.h"
+#include "PrimitiveSceneProxy.h"
+#include "SceneManagement.h"
+#include "StaticMeshResources.h"
+
+class FglTFRuntimeLinesSceneProxy final : public FPrimitiveSceneProxy
+{
+public:
+	FglTFRuntimeLinesSceneProxy(const UglTFRuntimeLinesComponent* InComponent) : FPrimitiveSceneProxy(InComponent), VertexFactory(GetScene().GetFeatureLevel(), "FglTFRuntimeLinesSceneProxy")
+	{
+		bWillEverBeLit = false;
+
+		const TArray<FglTFRuntimeLine>& Lines = InComponent->GetLines();
+
+		// build the line list once, in component space, the gpu applies the primitive transform
+		TArray<FDynamicMeshVertex> Vertices;
+		Vertices.Reserve(Lines.Num() * 2);
+		IndexBuffer.Indices.Reserve(Lines.Num() * 2);
+		for (const FglTFRuntimeLine& Line : Lines)
+		{
+			IndexBuffer.Indices.Add(Vertices.Add(FDynamicMeshVertex(FVector3f(Line.Start), FVector2f::ZeroVector, Line.StartColor)));
+			IndexBuffer.Indices.Add(Vertices.Add(FDynamicMeshVertex(FVector3f(Line.End), FVector2f::ZeroVector, Line.EndColor)));
+		}
+
+		NumLines = Lines.Num();
+		NumVertices = Vertices.Num();
+
+		VertexBuffers.InitFromDynamicVertex(&VertexFactory, Vertices);
+
+		BeginInitResource(&VertexBuffers.PositionVertexBuffer);
+		BeginInitResource(&VertexBuffers.StaticMeshVertexBuffer);
+		BeginInitResource(&VertexBuffers.ColorVertexBuffer);
+		BeginInitResource(&IndexBuffer);
+		BeginInitResource(&VertexFactory);
+
+		Material = UglTFRuntimeLinesComponent::GetLinesMaterial();
+		MaterialRelevance = Material->GetRelevance_Concurrent(GetScene().GetFeatureLevel());
+	}
+
+	virtual ~FglTFRuntimeLinesSceneProxy()
+	{
+		VertexBuffers.PositionVertexBuffer.ReleaseResource();
+		VertexBuffers.StaticMeshVertexBuffer.ReleaseResource();
+		VertexBuffers.ColorVertexBuffer.ReleaseResource();
+		IndexBuffer.ReleaseResource();
+		VertexFactory.ReleaseResource();
+	}
+
+	virtual SIZE_T GetTypeHash() const override
+	{
+		static size_t UniquePointer;
+		return reinterpret_cast<size_t>(&UniquePointer);
+	}
+
+	virtual void DrawStaticElements(FStaticPrimitiveDrawInterface* PDI) override
+	{
+		FMeshBatch Mesh;
+		Mesh.VertexFactory = &VertexFactory;
+		Mesh.MaterialRenderProxy = Material->GetRenderProxy();
+		Mesh.Type = PT_LineList;
+		Mesh.DepthPriorityGroup = SDPG_World;
+		Mesh.ReverseCulling = false;
+		Mesh.CastShadow = false;
+		Mesh.bCanApplyViewModeOverrides = false;
+		Mesh.LODIndex = 0;
+
+		FMeshBatchElement& BatchElement = Mesh.Elements[0];
+		BatchElement.IndexBuffer = &IndexBuffer;
+		BatchElement.FirstIndex = 0;
+		BatchElement.NumPrimitives = NumLines;
+		BatchElement.MinVertexIndex = 0;
+		BatchElement.MaxVertexIndex = NumVertices - 1;
+		BatchElement.PrimitiveUniformBuffer = GetUniformBuffer();
+
+		PDI->DrawMesh(Mesh, FLT_MAX);
+	}
+
+	virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override
+	{
+		FPrimitiveViewRelevance Result;
+		Result.bDrawRelevance = IsShown(View);
+		Result.bStaticRelevance = true;
+		Result.bShadowRelevance = false;
+		Result.bRenderInMainPass = ShouldRenderInMainPass();
+		MaterialRelevance.SetPrimitiveViewRelevance(Result);
+		return Result;
+	}
+
+	virtual uint32 GetMemoryFootprint() const override
+	{
+		return sizeof(*this) + GetAllocatedSize();
+	}
+
+	uint32 GetAllocatedSize() const
+	{
+		return FPrimitiveSceneProxy::GetAllocatedSize() + IndexBuffer.Indices.GetAllocatedSize();
+	}
+
+private:
+	FStaticMeshVertexBuffers VertexBuffers;
+	FDynamicMeshIndexBuffer32 IndexBuffer;
+	FLocalVertexFactory VertexFactory;
+	UMaterialInterface* Material;
+	FMaterialRelevance MaterialRelevance;
+	int32 NumLines;
+	int32 NumVertices;
+};
+
+UglTFRuntimeLinesComponent::UglTFRuntimeLinesComponent()
+{
+	LocalBounds = FBox(ForceInit);
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetGenerateOverlapEvents(false);
+	CastShadow = false;
+}
+
+void UglTFRuntimeLinesComponent::SetLines(TArray<FglTFRuntimeLine>&& InLines)
+{
+	Lines = MoveTemp(InLines);
+
+	LocalBounds = FBox(ForceInit);
+	for (const FglTFRuntimeLine& Line : Lines)
+	{
+		LocalBounds += Line.Start;
+		LocalBounds += Line.End;
+	}
+
+	UpdateBounds();
+	MarkRenderStateDirty();
+}
+
+FPrimitiveSceneProxy* UglTFRuntimeLinesComponent::CreateSceneProxy()
+{
+	if (Lines.Num() == 0)
+	{
+		return nullptr;
+	}
+	return new FglTFRuntimeLinesSceneProxy(this);
+}
+
+void UglTFRuntimeLinesComponent::GetUsedMaterials(TArray<UMaterialInterface*>& OutMaterials, bool bGetDebugMaterials) const
+{
+	OutMaterials.Add(GetLinesMaterial());
+}
+
+UMaterialInterface* UglTFRuntimeLinesComponent::GetLinesMaterial()
+{
+	// unlit vertex colors, line colors are stored in the color vertex buffer
+	if (GEngine && GEngine->VertexColorMaterial)
+	{
+		return GEngine->VertexColorMaterial;
+	}
+	return UMaterial::GetDefaultMaterial(MD_Surface);
+}
+
+FBoxSphereBounds UglTFRuntimeLinesComponent::CalcBounds(const FTransform& LocalToWorld) const
+{
+	if (!LocalBounds.IsValid)
+	{
+		return FBoxSphereBounds(LocalToWorld.GetLocation(), FVector::ZeroVector, 0);
+	}
+	return FBoxSphereBounds(LocalBounds.TransformBy(LocalToWorld));
+}
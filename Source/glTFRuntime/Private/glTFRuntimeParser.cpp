@@ -1,9 +1,13 @@
 // Copyright 2020-2023, Roberto De Ioris.
 
 #include "glTFRuntimeParser.h"
+#include "glTFRuntime.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/ThreadSafeBool.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Engine/Texture2D.h"
+#include "HAL/PlatformFileManager.h"
 #include "Misc/FileHelper.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -82,7 +86,7 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& F
 		return nullptr;
 	}
 
-	TSharedPtr<FglTFRuntimeParser> Parser = FromData(Content.GetData(), Content.Num(), LoaderConfig);
+	TSharedPtr<FglTFRuntimeParser> Parser = FromOwnedData(MoveTemp(Content), LoaderConfig);
 
 	if (Parser && LoaderConfig.bAllowExternalFiles)
 	{
@@ -93,6 +97,35 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& F
 	return Parser;
 }
 
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromOwnedData(TArray64<uint8>&& Data, const FglTFRuntimeConfig& LoaderConfig)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromOwnedData, FColor::Magenta);
+
+	// compressed, archived and json data always end in new buffers, so only plain GLB files can be referenced in place
+	if (LoaderConfig.bAsBlob || Data.Num() <= 20 || Data[0] != 0x67 || Data[1] != 0x6C || Data[2] != 0x54 || Data[3] != 0x46)
+	{
+		return FromData(Data.GetData(), Data.Num(), LoaderConfig);
+	}
+
+	FString JsonData;
+	int64 BinaryChunkOffset = 0;
+	int64 BinaryChunkNum = 0;
+	if (!GetBinaryChunks(Data.GetData(), Data.Num(), JsonData, BinaryChunkOffset, BinaryChunkNum))
+	{
+		return nullptr;
+	}
+
+	TMap<FString, FBinaryData> emptyData;
+	TSharedPtr<FglTFRuntimeParser> Parser = FromString(JsonData, LoaderConfig, emptyData, nullptr);
+
+	if (Parser && BinaryChunkNum > 0)
+	{
+		Parser->SetBinaryBuffer(MoveTemp(Data), BinaryChunkOffset, BinaryChunkNum);
+	}
+
+	return Parser;
+}
+
 TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromData, FColor::Magenta);
@@ -307,29 +340,534 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& Jso
 		}
 		Parser->DefaultPrefixForUnnamedNodes = LoaderConfig.PrefixForUnnamedNodes;
 		Parser->ZipFile = InZipFile;
+		Parser->bMapExternalFiles = LoaderConfig.bMapExternalFiles;
+		Parser->bParallelPrimitivesDecoding = LoaderConfig.bParallelPrimitivesDecoding;
 
-		Parser->AuxilliaryData = aux;
+		// shared entries only bump their reference count
+		for (const TPair<FString, FBinaryData>& Pair : aux)
+		{
+			Parser->AuxilliaryData.Add(Pair.Key, MakeShared<const FBinaryData, ESPMode::ThreadSafe>(Pair.Value));
+		}
 	}
 
 	return Parser;
 }
 
-TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile)
+namespace glTFRuntimeUpdate
 {
-	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromBinary, FColor::Magenta);
+	const TArray<TSharedPtr<FJsonValue>>& GetRootArray(TSharedRef<FJsonObject> JsonObject, const FString& FieldName)
+	{
+		static const TArray<TSharedPtr<FJsonValue>> EmptyArray;
+		const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+		if (JsonObject->TryGetArrayField(FieldName, JsonArray))
+		{
+			return *JsonArray;
+		}
+		return EmptyArray;
+	}
 
-	FString JsonData;
-	TArray64<uint8> BinaryBuffer;
+	bool ItemChanged(const TArray<TSharedPtr<FJsonValue>>& OldItems, const TArray<TSharedPtr<FJsonValue>>& NewItems, const int32 Index)
+	{
+		if (!OldItems.IsValidIndex(Index) || !NewItems.IsValidIndex(Index))
+		{
+			return true;
+		}
+		return !FJsonValue::CompareEqual(*OldItems[Index], *NewItems[Index]);
+	}
+
+	bool ArrayChanged(TSharedRef<FJsonObject> OldRoot, TSharedRef<FJsonObject> NewRoot, const FString& FieldName)
+	{
+		const TArray<TSharedPtr<FJsonValue>>& OldItems = GetRootArray(OldRoot, FieldName);
+		const TArray<TSharedPtr<FJsonValue>>& NewItems = GetRootArray(NewRoot, FieldName);
+		if (OldItems.Num() != NewItems.Num())
+		{
+			return true;
+		}
+		for (int32 Index = 0; Index < NewItems.Num(); Index++)
+		{
+			if (ItemChanged(OldItems, NewItems, Index))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool IndexIsDirty(TSharedPtr<FJsonObject> JsonObject, const FString& FieldName, const TSet<int32>& DirtyIndices)
+	{
+		int64 Index;
+		return JsonObject && JsonObject->TryGetNumberField(FieldName, Index) && DirtyIndices.Contains(static_cast<int32>(Index));
+	}
+
+	bool ExtensionIndexIsDirty(TSharedPtr<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName, const TSet<int32>& DirtyIndices)
+	{
+		const TSharedPtr<FJsonObject>* JsonExtensionsObject;
+		const TSharedPtr<FJsonObject>* JsonExtensionObject;
+		if (JsonObject && JsonObject->TryGetObjectField("extensions", JsonExtensionsObject) && (*JsonExtensionsObject)->TryGetObjectField(ExtensionName, JsonExtensionObject))
+		{
+			return IndexIsDirty(*JsonExtensionObject, FieldName, DirtyIndices);
+		}
+		return false;
+	}
+
+	// any "source" of the texture extensions (EXT_texture_webp, MSFT_texture_dds...)
+	bool ExtensionsSourceIsDirty(TSharedPtr<FJsonObject> JsonTextureObject, const TSet<int32>& DirtyImages)
+	{
+		const TSharedPtr<FJsonObject>* JsonExtensionsObject;
+		if (!JsonTextureObject || !JsonTextureObject->TryGetObjectField("extensions", JsonExtensionsObject))
+		{
+			return false;
+		}
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*JsonExtensionsObject)->Values)
+		{
+			if (IndexIsDirty(Pair.Value->AsObject(), "source", DirtyImages))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// texture infos ({"index": N}) can be anywhere in a material (extensions included)
+	bool TexturesAreDirty(TSharedPtr<FJsonObject> JsonObject, const TSet<int32>& DirtyTextures)
+	{
+		if (!JsonObject)
+		{
+			return false;
+		}
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : JsonObject->Values)
+		{
+			const TSharedPtr<FJsonObject>* JsonChildObject;
+			if (!Pair.Value->TryGetObject(JsonChildObject))
+			{
+				continue;
+			}
+			if ((Pair.Key.EndsWith("Texture") && IndexIsDirty(*JsonChildObject, "index", DirtyTextures)) || TexturesAreDirty(*JsonChildObject, DirtyTextures))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool AttributesAreDirty(TSharedPtr<FJsonObject> JsonAttributesObject, const TSet<int32>& DirtyAccessors)
+	{
+		if (!JsonAttributesObject)
+		{
+			return false;
+		}
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : JsonAttributesObject->Values)
+		{
+			double Index;
+			if (Pair.Value->TryGetNumber(Index) && DirtyAccessors.Contains(static_cast<int32>(Index)))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+bool FglTFRuntimePendingUpdate::GetNodeMeshIndex(const int32 NodeIndex, int32& MeshIndex) const
+{
+	MeshIndex = INDEX_NONE;
+	if (!Root)
+	{
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>& Nodes = glTFRuntimeUpdate::GetRootArray(Root.ToSharedRef(), "nodes");
+	if (!Nodes.IsValidIndex(NodeIndex))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonNodeObject = Nodes[NodeIndex]->AsObject();
+	if (!JsonNodeObject)
+	{
+		return false;
+	}
+
+	int64 JsonMeshIndex;
+	if (JsonNodeObject->TryGetNumberField("mesh", JsonMeshIndex))
+	{
+		MeshIndex = static_cast<int32>(JsonMeshIndex);
+	}
+	return true;
+}
+
+bool FglTFRuntimeParser::UpdateFromString(const FString& JsonData, const TMap<FString, FBinaryData>& ChangedAux, FglTFRuntimeSceneUpdate& SceneUpdate)
+{
+	FglTFRuntimePendingUpdate PendingUpdate;
+	if (!DiffFromString(JsonData, ChangedAux, SceneUpdate, PendingUpdate))
+	{
+		return false;
+	}
+
+	ApplyUpdate(PendingUpdate);
+	return true;
+}
+
+bool FglTFRuntimeParser::DiffFromString(const FString& JsonData, const TMap<FString, FBinaryData>& ChangedAux, FglTFRuntimeSceneUpdate& SceneUpdate, FglTFRuntimePendingUpdate& PendingUpdate)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DiffFromString, FColor::Magenta);
+
+	using namespace glTFRuntimeUpdate;
+
+	SceneUpdate = FglTFRuntimeSceneUpdate();
+	PendingUpdate = FglTFRuntimePendingUpdate();
+
+	TSharedPtr<FJsonValue> RootValue;
+	TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonData);
+	if (!FJsonSerializer::Deserialize(JsonReader, RootValue) || !RootValue->AsObject())
+	{
+		AddError("DiffFromString()", "Unable to parse json");
+		return false;
+	}
+
+	TSharedRef<FJsonObject> NewRoot = RootValue->AsObject().ToSharedRef();
+
+	// buffers: changed json or new data in the aux map
+	TSet<int32> DirtyBuffers;
+	const TArray<TSharedPtr<FJsonValue>>& NewBuffers = GetRootArray(NewRoot, "buffers");
+	for (int32 Index = 0; Index < NewBuffers.Num(); Index++)
+	{
+		TSharedPtr<FJsonObject> JsonBufferObject = NewBuffers[Index]->AsObject();
+		FString Uri;
+		if (ItemChanged(GetRootArray(Root, "buffers"), NewBuffers, Index) || (JsonBufferObject && JsonBufferObject->TryGetStringField("uri", Uri) && ChangedAux.Contains(Uri)))
+		{
+			DirtyBuffers.Add(Index);
+		}
+	}
+
+	TSet<int32> DirtyBufferViews;
+	const TArray<TSharedPtr<FJsonValue>>& NewBufferViews = GetRootArray(NewRoot, "bufferViews");
+	for (int32 Index = 0; Index < NewBufferViews.Num(); Index++)
+	{
+		TSharedPtr<FJsonObject> JsonBufferViewObject = NewBufferViews[Index]->AsObject();
+		if (ItemChanged(GetRootArray(Root, "bufferViews"), NewBufferViews, Index) ||
+			IndexIsDirty(JsonBufferViewObject, "buffer", DirtyBuffers) ||
+			ExtensionIndexIsDirty(JsonBufferViewObject, "EXT_meshopt_compression", "buffer", DirtyBuffers) ||
+			ExtensionIndexIsDirty(JsonBufferViewObject, "KHR_meshopt_compression", "buffer", DirtyBuffers))
+		{
+			DirtyBufferViews.Add(Index);
+		}
+	}
+
+	TSet<int32> DirtyAccessors;
+	const TArray<TSharedPtr<FJsonValue>>& NewAccessors = GetRootArray(NewRoot, "accessors");
+	for (int32 Index = 0; Index < NewAccessors.Num(); Index++)
+	{
+		TSharedPtr<FJsonObject> JsonAccessorObject = NewAccessors[Index]->AsObject();
+		bool bDirty = ItemChanged(GetRootArray(Root, "accessors"), NewAccessors, Index) || IndexIsDirty(JsonAccessorObject, "bufferView", DirtyBufferViews);
+		const TSharedPtr<FJsonObject>* JsonSparseObject;
+		if (!bDirty && JsonAccessorObject && JsonAccessorObject->TryGetObjectField("sparse", JsonSparseObject))
+		{
+			const TSharedPtr<FJsonObject>* JsonSparseIndicesObject;
+			const TSharedPtr<FJsonObject>* JsonSparseValuesObject;
+			bDirty = ((*JsonSparseObject)->TryGetObjectField("indices", JsonSparseIndicesObject) && IndexIsDirty(*JsonSparseIndicesObject, "bufferView", DirtyBufferViews)) ||
+				((*JsonSparseObject)->TryGetObjectField("values", JsonSparseValuesObject) && IndexIsDirty(*JsonSparseValuesObject, "bufferView", DirtyBufferViews));
+		}
+		if (bDirty)
+		{
+			DirtyAccessors.Add(Index);
+		}
+	}
+
+	// images: changed json, changed bufferView or new data in the aux map
+	TSet<int32> DirtyImages;
+	const TArray<TSharedPtr<FJsonValue>>& NewImages = GetRootArray(NewRoot, "images");
+	for (int32 Index = 0; Index < NewImages.Num(); Index++)
+	{
+		TSharedPtr<FJsonObject> JsonImageObject = NewImages[Index]->AsObject();
+		FString Uri;
+		if (ItemChanged(GetRootArray(Root, "images"), NewImages, Index) ||
+			IndexIsDirty(JsonImageObject, "bufferView", DirtyBufferViews) ||
+			(JsonImageObject && JsonImageObject->TryGetStringField("uri", Uri) && ChangedAux.Contains(Uri)))
+		{
+			DirtyImages.Add(Index);
+		}
+	}
+
+	TSet<int32> DirtySamplers;
+	const TArray<TSharedPtr<FJsonValue>>& NewSamplers = GetRootArray(NewRoot, "samplers");
+	for (int32 Index = 0; Index < NewSamplers.Num(); Index++)
+	{
+		if (ItemChanged(GetRootArray(Root, "samplers"), NewSamplers, Index))
+		{
+			DirtySamplers.Add(Index);
+		}
+	}
+
+	TSet<int32> DirtyTextures;
+	const TArray<TSharedPtr<FJsonValue>>& NewTextures = GetRootArray(NewRoot, "textures");
+	for (int32 Index = 0; Index < NewTextures.Num(); Index++)
+	{
+		TSharedPtr<FJsonObject> JsonTextureObject = NewTextures[Index]->AsObject();
+		if (ItemChanged(GetRootArray(Root, "textures"), NewTextures, Index) ||
+			IndexIsDirty(JsonTextureObject, "source", DirtyImages) ||
+			IndexIsDirty(JsonTextureObject, "sampler", DirtySamplers) ||
+			ExtensionsSourceIsDirty(JsonTextureObject, DirtyImages))
+		{
+			DirtyTextures.Add(Index);
+		}
+	}
+
+	TSet<int32> DirtyMaterials;
+	const TArray<TSharedPtr<FJsonValue>>& NewMaterials = GetRootArray(NewRoot, "materials");
+	for (int32 Index = 0; Index < NewMaterials.Num(); Index++)
+	{
+		if (ItemChanged(GetRootArray(Root, "materials"), NewMaterials, Index) || TexturesAreDirty(NewMaterials[Index]->AsObject(), DirtyTextures))
+		{
+			DirtyMaterials.Add(Index);
+		}
+	}
+
+	TSet<int32> DirtyMeshes;
+	const TArray<TSharedPtr<FJsonValue>>& NewMeshes = GetRootArray(NewRoot, "meshes");
+	for (int32 Index = 0; Index < NewMeshes.Num(); Index++)
+	{
+		bool bDirty = ItemChanged(GetRootArray(Root, "meshes"), NewMeshes, Index);
+		TSharedPtr<FJsonObject> JsonMeshObject = NewMeshes[Index]->AsObject();
+		const TArray<TSharedPtr<FJsonValue>>* JsonPrimitives;
+		if (!bDirty && JsonMeshObject && JsonMeshObject->TryGetArrayField("primitives", JsonPrimitives))
+		{
+			for (const TSharedPtr<FJsonValue>& JsonPrimitive : *JsonPrimitives)
+			{
+				TSharedPtr<FJsonObject> JsonPrimitiveObject = JsonPrimitive->AsObject();
+				if (!JsonPrimitiveObject)
+				{
+					continue;
+				}
+
+				const TSharedPtr<FJsonObject>* JsonAttributesObject;
+				if ((JsonPrimitiveObject->TryGetObjectField("attributes", JsonAttributesObject) && AttributesAreDirty(*JsonAttributesObject, DirtyAccessors)) ||
+					IndexIsDirty(JsonPrimitiveObject, "indices", DirtyAccessors) ||
+					IndexIsDirty(JsonPrimitiveObject, "material", DirtyMaterials) ||
+					ExtensionIndexIsDirty(JsonPrimitiveObject, "KHR_draco_mesh_compression", "bufferView", DirtyBufferViews))
+				{
+					bDirty = true;
+					break;
+				}
+
+				const TArray<TSharedPtr<FJsonValue>>* JsonTargets;
+				if (JsonPrimitiveObject->TryGetArrayField("targets", JsonTargets))
+				{
+					for (const TSharedPtr<FJsonValue>& JsonTarget : *JsonTargets)
+					{
+						if (AttributesAreDirty(JsonTarget->AsObject(), DirtyAccessors))
+						{
+							bDirty = true;
+							break;
+						}
+					}
+				}
+
+				if (bDirty)
+				{
+					break;
+				}
+			}
+		}
+
+		if (bDirty)
+		{
+			DirtyMeshes.Add(Index);
+		}
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>& OldNodes = GetRootArray(Root, "nodes");
+	const TArray<TSharedPtr<FJsonValue>>& NewNodes = GetRootArray(NewRoot, "nodes");
+	SceneUpdate.bStructureChanged = OldNodes.Num() != NewNodes.Num() || ArrayChanged(Root, NewRoot, "scenes") || ArrayChanged(Root, NewRoot, "skins");
+	for (int32 Index = 0; Index < NewNodes.Num() && !SceneUpdate.bStructureChanged; Index++)
+	{
+		if (!ItemChanged(OldNodes, NewNodes, Index))
+		{
+			continue;
+		}
+
+		// a different hierarchy cannot be patched
+		TSharedPtr<FJsonObject> OldJsonNodeObject = OldNodes[Index]->AsObject();
+		TSharedPtr<FJsonObject> NewJsonNodeObject = NewNodes[Index]->AsObject();
+		const TSharedPtr<FJsonValue> OldChildren = OldJsonNodeObject ? OldJsonNodeObject->TryGetField("children") : nullptr;
+		const TSharedPtr<FJsonValue> NewChildren = NewJsonNodeObject ? NewJsonNodeObject->TryGetField("children") : nullptr;
+		if (OldChildren.IsValid() != NewChildren.IsValid() || (OldChildren && !FJsonValue::CompareEqual(*OldChildren, *NewChildren)))
+		{
+			SceneUpdate.bStructureChanged = true;
+			break;
+		}
+
+		SceneUpdate.DirtyNodes.Add(Index);
+	}
+
+	SceneUpdate.DirtyMeshes = DirtyMeshes.Array();
+	SceneUpdate.DirtyMaterials = DirtyMaterials.Array();
+
+	PendingUpdate.Root = NewRoot;
+	for (const TPair<FString, FBinaryData>& Pair : ChangedAux)
+	{
+		PendingUpdate.ChangedAux.Add(Pair.Key, MakeShared<const FBinaryData, ESPMode::ThreadSafe>(Pair.Value));
+	}
+	PendingUpdate.DirtyBuffers = MoveTemp(DirtyBuffers);
+	PendingUpdate.DirtyBufferViews = MoveTemp(DirtyBufferViews);
+	PendingUpdate.DirtyAccessors = MoveTemp(DirtyAccessors);
+	PendingUpdate.DirtyTextures = MoveTemp(DirtyTextures);
+	PendingUpdate.DirtyMaterials = MoveTemp(DirtyMaterials);
+	PendingUpdate.DirtyMeshes = MoveTemp(DirtyMeshes);
+
+	return true;
+}
+
+void FglTFRuntimeParser::ApplyUpdate(const FglTFRuntimePendingUpdate& PendingUpdate)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_ApplyUpdate, FColor::Magenta);
+
+	if (!PendingUpdate.Root)
+	{
+		return;
+	}
+
+	// now switch to the new revision and drop only the stale data
+	Root = PendingUpdate.Root.ToSharedRef();
+	ExtensionsUsed.Empty();
+	ExtensionsRequired.Empty();
+	Root->TryGetStringArrayField("extensionsUsed", ExtensionsUsed);
+	Root->TryGetStringArrayField("extensionsRequired", ExtensionsRequired);
+
+	for (const TPair<FString, TSharedRef<const FBinaryData, ESPMode::ThreadSafe>>& Pair : PendingUpdate.ChangedAux)
+	{
+		AuxilliaryData.Add(Pair.Key, Pair.Value);
+	}
 
+	{
+		FWriteScopeLock Lock(BuffersCacheLock);
+		for (const int32 Index : PendingUpdate.DirtyBuffers)
+		{
+			BuffersCache.Remove(Index);
+			MappedBuffersCache.Remove(Index);
+			AuxBuffersCache.Remove(Index);
+		}
+	}
+
+	{
+		FWriteScopeLock Lock(CompressedBufferViewsCacheLock);
+		for (const int32 Index : PendingUpdate.DirtyBufferViews)
+		{
+			CompressedBufferViewsCache.Remove(Index);
+			CompressedBufferViewsStridesCache.Remove(Index);
+		}
+	}
+
+	{
+		FWriteScopeLock Lock(SparseAccessorsCacheLock);
+		for (const int32 Index : PendingUpdate.DirtyAccessors)
+		{
+			SparseAccessorsCache.Remove(Index);
+			SparseAccessorsStridesCache.Remove(Index);
+		}
+	}
+
+	AdditionalBufferViewsCache.Empty();
+	AdditionalBufferViewsData.Empty();
+
+	// LODs are keyed by the json objects of the previous revision,
+	// running loads still point to them so they are retired instead of released
+	{
+		FWriteScopeLock Lock(LODsCacheLock);
+		if (LODsPins > 0)
+		{
+			for (const TPair<TSharedRef<FJsonObject>, TSharedPtr<FglTFRuntimeMeshLOD>>& Pair : LODsCache)
+			{
+				RetiredLODs.Add(Pair.Value);
+			}
+		}
+		LODsCache.Empty();
+	}
+
+	{
+		FScopeLock Lock(&AllNodesCacheLock);
+		AllNodesCache.Empty();
+		bAllNodesCached = false;
+	}
+
+	{
+		FWriteScopeLock Lock(MaterialsCacheLock);
+		for (const int32 Index : PendingUpdate.DirtyMaterials)
+		{
+			UMaterialInterface* Material = nullptr;
+			if (MaterialsCache.RemoveAndCopyValue(Index, Material))
+			{
+				MaterialsNameCache.Remove(Material);
+			}
+		}
+	}
+
+	{
+		FWriteScopeLock Lock(TexturesCacheLock);
+		for (const int32 Index : PendingUpdate.DirtyTextures)
+		{
+			TexturesCache.Remove(Index);
+		}
+	}
+
+	{
+		FScopeLock Lock(&PrefetchedMipsCacheLock);
+		PrefetchedMipsCache.Empty();
+		PrefetchPendingMaterials.Empty();
+		bTexturesPrefetched = false;
+	}
+
+	{
+		FScopeLock Lock(&TextureStreamingSourcesLock);
+		TextureStreamingSources.Empty();
+	}
+
+	for (const int32 Index : PendingUpdate.DirtyMeshes)
+	{
+		StaticMeshesCache.Remove(Index);
+		SkeletalMeshesCache.Remove(Index);
+	}
+}
+
+void FglTFRuntimeParser::PinLODs()
+{
+	FWriteScopeLock Lock(LODsCacheLock);
+	LODsPins++;
+}
+
+void FglTFRuntimeParser::UnpinLODs()
+{
+	FWriteScopeLock Lock(LODsCacheLock);
+	if (--LODsPins == 0)
+	{
+		RetiredLODs.Empty();
+	}
+}
+
+FglTFRuntimeLODsPin::FglTFRuntimeLODsPin(TSharedRef<FglTFRuntimeParser> InParser) : Parser(InParser)
+{
+	Parser->PinLODs();
+}
+
+FglTFRuntimeLODsPin::~FglTFRuntimeLODsPin()
+{
+	Parser->UnpinLODs();
+}
+
+bool FglTFRuntimeParser::GetBinaryChunks(const uint8* DataPtr, const int64 DataNum, FString& JsonData, int64& BinaryChunkOffset, int64& BinaryChunkNum)
+{
 	bool bJsonFound = false;
 	bool bBinaryFound = false;
 	int64 BlobIndex = 12;
 
+	BinaryChunkOffset = 0;
+	BinaryChunkNum = 0;
+
 	while (BlobIndex < DataNum)
 	{
 		if (BlobIndex + 8 > DataNum)
 		{
-			return nullptr;
+			return false;
 		}
 
 		uint32* ChunkLength = (uint32*)&DataPtr[BlobIndex];
@@ -339,7 +877,7 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataP
 
 		if ((BlobIndex + *ChunkLength) > DataNum)
 		{
-			return nullptr;
+			return false;
 		}
 
 		if (*ChunkType == 0x4E4F534A && !bJsonFound)
@@ -351,13 +889,25 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataP
 		else if (*ChunkType == 0x004E4942 && !bBinaryFound)
 		{
 			bBinaryFound = true;
-			BinaryBuffer.Append(&DataPtr[BlobIndex], *ChunkLength);
+			BinaryChunkOffset = BlobIndex;
+			BinaryChunkNum = *ChunkLength;
 		}
 
 		BlobIndex += *ChunkLength;
 	}
 
-	if (!bJsonFound)
+	return bJsonFound;
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromBinary, FColor::Magenta);
+
+	FString JsonData;
+	int64 BinaryChunkOffset = 0;
+	int64 BinaryChunkNum = 0;
+
+	if (!GetBinaryChunks(DataPtr, DataNum, JsonData, BinaryChunkOffset, BinaryChunkNum))
 	{
 		return nullptr;
 	}
@@ -367,9 +917,9 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataP
 
 	if (Parser)
 	{
-		if (bBinaryFound)
+		if (BinaryChunkNum > 0)
 		{
-			Parser->SetBinaryBuffer(BinaryBuffer);
+			Parser->SetBinaryBuffer(&DataPtr[BinaryChunkOffset], BinaryChunkNum);
 		}
 	}
 
@@ -526,6 +1076,9 @@ void FglTFRuntimeParser::LoadAndFillBaseMaterials()
 FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const FMatrix& InSceneBasis, float InSceneScale) : Root(JsonObject), SceneBasis(InSceneBasis), SceneScale(InSceneScale)
 {
 	bAllNodesCached = false;
+	bTexturesPrefetched = false;
+	bMapExternalFiles = true;
+	bParallelPrimitivesDecoding = false;
 	DownloadTime = 0;
 
 	if (IsInGameThread())
@@ -577,6 +1130,14 @@ bool FglTFRuntimeParser::LoadNodes()
 		return true;
 	}
 
+	FScopeLock Lock(&AllNodesCacheLock);
+
+	// another thread may have completed the cache while we were waiting
+	if (bAllNodesCached)
+	{
+		return true;
+	}
+
 	const TArray<TSharedPtr<FJsonValue>>* JsonNodes;
 
 	// no nodes ?
@@ -591,12 +1152,14 @@ bool FglTFRuntimeParser::LoadNodes()
 		TSharedPtr<FJsonObject> JsonNodeObject = (*JsonNodes)[Index]->AsObject();
 		if (!JsonNodeObject)
 		{
+			AllNodesCache.Empty();
 			return false;
 		}
 
 		FglTFRuntimeNode Node;
 		if (!LoadNode_Internal(Index, JsonNodeObject.ToSharedRef(), JsonNodes->Num(), Node))
 		{
+			AllNodesCache.Empty();
 			return false;
 		}
 
@@ -1097,16 +1660,59 @@ bool FglTFRuntimeParser::LoadJointByName(const int64 RootBoneIndex, const FStrin
 void FglTFRuntimeParser::AddError(const FString& ErrorContext, const FString& ErrorMessage)
 {
 	FString FullMessage = ErrorContext + ": " + ErrorMessage;
-	Errors.Add(FullMessage);
+	{
+		// errors can be reported by parallel decoders
+		FScopeLock Lock(&ErrorsLock);
+		Errors.Add(FullMessage);
+	}
 	UE_LOG(LogGLTFRuntime, Error, TEXT("%s"), *FullMessage);
 	if (OnError.IsBound())
 	{
-		OnError.Broadcast(ErrorContext, ErrorMessage);
+		if (IsInGameThread())
+		{
+			OnError.Broadcast(ErrorContext, ErrorMessage);
+		}
+		else if (DoesSharedInstanceExist())
+		{
+			// the listeners run on the game thread, errors from parallel and async loaders are queued
+			// and a single task broadcasts all of them
+			bool bScheduleBroadcast = false;
+			{
+				FScopeLock Lock(&ErrorsLock);
+				bScheduleBroadcast = PendingErrors.Num() == 0;
+				PendingErrors.Add(TPair<FString, FString>(ErrorContext, ErrorMessage));
+			}
+
+			if (bScheduleBroadcast)
+			{
+				TSharedRef<FglTFRuntimeParser> Parser = AsShared();
+				RunOnGameThread([Parser]()
+					{
+						Parser->BroadcastPendingErrors();
+					});
+			}
+		}
+	}
+}
+
+void FglTFRuntimeParser::BroadcastPendingErrors()
+{
+	TArray<TPair<FString, FString>> ErrorsToBroadcast;
+	{
+		FScopeLock Lock(&ErrorsLock);
+		ErrorsToBroadcast = MoveTemp(PendingErrors);
+		PendingErrors.Reset();
+	}
+
+	for (const TPair<FString, FString>& Error : ErrorsToBroadcast)
+	{
+		OnError.Broadcast(Error.Key, Error.Value);
 	}
 }
 
 void FglTFRuntimeParser::ClearErrors()
 {
+	FScopeLock Lock(&ErrorsLock);
 	Errors.Empty();
 }
 
@@ -2441,24 +3047,34 @@ bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject,
 
 	int32 FirstPrimitive = Primitives.Num();
 
-	for (TSharedPtr<FJsonValue> JsonPrimitive : *JsonPrimitives)
+	if (bParallelPrimitivesDecoding && JsonPrimitives->Num() > 1)
 	{
-		TSharedPtr<FJsonObject> JsonPrimitiveObject = JsonPrimitive->AsObject();
-		if (!JsonPrimitiveObject)
+		if (!LoadPrimitivesParallel(*JsonPrimitives, Primitives, MaterialsConfig))
 		{
 			return false;
 		}
-
-		FglTFRuntimePrimitive Primitive;
-		if (!LoadPrimitive(JsonPrimitiveObject.ToSharedRef(), Primitive, MaterialsConfig))
+	}
+	else
+	{
+		for (TSharedPtr<FJsonValue> JsonPrimitive : *JsonPrimitives)
 		{
-			return false;
-		}
+			TSharedPtr<FJsonObject> JsonPrimitiveObject = JsonPrimitive->AsObject();
+			if (!JsonPrimitiveObject)
+			{
+				return false;
+			}
 
-		// add the primitive only if it has at least one index 
-		if (Primitive.Indices.Num() > 0)
-		{
-			Primitives.Add(Primitive);
+			FglTFRuntimePrimitive Primitive;
+			if (!LoadPrimitive(JsonPrimitiveObject.ToSharedRef(), Primitive, MaterialsConfig))
+			{
+				return false;
+			}
+
+			// add the primitive only if it has at least one index 
+			if (Primitive.Indices.Num() > 0)
+			{
+				Primitives.Add(MoveTemp(Primitive));
+			}
 		}
 	}
 
@@ -2493,43 +3109,154 @@ bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject,
 		}
 	}
 
-	if (MaterialsConfig.bMergeSectionsByMaterial)
+	if (MaterialsConfig.bMergeSectionsByMaterial)
+	{
+		// pending materials all share the default material, so group them by material index too
+		TMap<TPair<UMaterialInterface*, int64>, TArray<FglTFRuntimePrimitive>> PrimitivesMap;
+		for (FglTFRuntimePrimitive& Primitive : Primitives)
+		{
+			PrimitivesMap.FindOrAdd(TPair<UMaterialInterface*, int64>(Primitive.Material, Primitive.bMaterialPending ? Primitive.MaterialIndex : INDEX_NONE)).Add(MoveTemp(Primitive));
+		}
+
+		TArray<FglTFRuntimePrimitive> MergedPrimitives;
+		for (TPair<TPair<UMaterialInterface*, int64>, TArray<FglTFRuntimePrimitive>>& Pair : PrimitivesMap)
+		{
+			FglTFRuntimePrimitive MergedPrimitive;
+			if (MergePrimitives(Pair.Value, MergedPrimitive))
+			{
+				MergedPrimitives.Add(MoveTemp(MergedPrimitive));
+			}
+			else
+			{
+				// unable to merge, just leave as is
+				for (FglTFRuntimePrimitive& Primitive : Pair.Value)
+				{
+					MergedPrimitives.Add(MoveTemp(Primitive));
+				}
+			}
+		}
+
+		Primitives = MoveTemp(MergedPrimitives);
+
+	}
+
+	return true;
+}
+
+bool FglTFRuntimeParser::LoadPrimitivesParallel(const TArray<TSharedPtr<FJsonValue>>& JsonPrimitives, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_LoadPrimitivesParallel, FColor::Magenta);
+
+	TArray<TSharedRef<FJsonObject>> JsonPrimitiveObjects;
+	for (TSharedPtr<FJsonValue> JsonPrimitive : JsonPrimitives)
+	{
+		TSharedPtr<FJsonObject> JsonPrimitiveObject = JsonPrimitive->AsObject();
+		if (!JsonPrimitiveObject)
+		{
+			return false;
+		}
+		JsonPrimitiveObjects.Add(JsonPrimitiveObject.ToSharedRef());
+	}
+
+	TArray<FglTFRuntimePrimitive> DecodedPrimitives;
+	DecodedPrimitives.SetNum(JsonPrimitiveObjects.Num());
+
+	// delegates are always triggered on the calling thread
+	for (int32 PrimitiveIndex = 0; PrimitiveIndex < JsonPrimitiveObjects.Num(); PrimitiveIndex++)
 	{
-		TMap<UMaterialInterface*, TArray<FglTFRuntimePrimitive>> PrimitivesMap;
-		for (FglTFRuntimePrimitive& Primitive : Primitives)
-		{
-			if (PrimitivesMap.Contains(Primitive.Material))
-			{
-				PrimitivesMap[Primitive.Material].Add(Primitive);
-			}
-			else
+		OnPreLoadedPrimitive.Broadcast(AsShared(), JsonPrimitiveObjects[PrimitiveIndex], DecodedPrimitives[PrimitiveIndex]);
+	}
+
+	// resolve buffers, meshopt bufferViews and sparse accessors before going wide, so the decoders only read the caches
+	for (int32 PrimitiveIndex = 0; PrimitiveIndex < JsonPrimitiveObjects.Num(); PrimitiveIndex++)
+	{
+		const TSharedRef<FJsonObject> JsonPrimitiveObject = JsonPrimitiveObjects[PrimitiveIndex];
+		const int64 AdditionalBufferView = DecodedPrimitives[PrimitiveIndex].AdditionalBufferView;
+
+		auto ResolveAccessors = [this, AdditionalBufferView](const TSharedPtr<FJsonObject>& JsonObject)
 			{
-				TArray<FglTFRuntimePrimitive> NewPrimitives;
-				NewPrimitives.Add(Primitive);
-				PrimitivesMap.Add(Primitive.Material, NewPrimitives);
-			}
+				for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : JsonObject->Values)
+				{
+					int64 AccessorIndex;
+					if (Pair.Value->TryGetNumber(AccessorIndex))
+					{
+						FglTFRuntimeBlob Blob;
+						int64 ComponentType, Stride, Elements, ElementSize, Count;
+						bool bNormalized = false;
+						// errors are reported by the decoding pass
+						GetAccessor(AccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bNormalized, Blob, GetAdditionalBufferView(AdditionalBufferView, Pair.Key));
+					}
+				}
+			};
+
+		const TSharedPtr<FJsonObject>* JsonAttributesObject;
+		if (JsonPrimitiveObject->TryGetObjectField("attributes", JsonAttributesObject))
+		{
+			ResolveAccessors(*JsonAttributesObject);
 		}
 
-		TArray<FglTFRuntimePrimitive> MergedPrimitives;
-		for (TPair<UMaterialInterface*, TArray<FglTFRuntimePrimitive>>& Pair : PrimitivesMap)
+		int64 IndicesAccessorIndex;
+		if (JsonPrimitiveObject->TryGetNumberField("indices", IndicesAccessorIndex))
 		{
-			FglTFRuntimePrimitive MergedPrimitive;
-			if (MergePrimitives(Pair.Value, MergedPrimitive))
-			{
-				MergedPrimitives.Add(MergedPrimitive);
-			}
-			else
+			TSharedRef<FJsonObject> JsonIndicesObject = MakeShared<FJsonObject>();
+			JsonIndicesObject->SetNumberField("indices", IndicesAccessorIndex);
+			ResolveAccessors(JsonIndicesObject);
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* JsonTargetsArray;
+		if (JsonPrimitiveObject->TryGetArrayField("targets", JsonTargetsArray))
+		{
+			for (TSharedPtr<FJsonValue> JsonTargetItem : *JsonTargetsArray)
 			{
-				// unable to merge, just leave as is
-				for (FglTFRuntimePrimitive& Primitive : Pair.Value)
+				TSharedPtr<FJsonObject> JsonTargetObject = JsonTargetItem->AsObject();
+				if (JsonTargetObject)
 				{
-					MergedPrimitives.Add(Primitive);
+					ResolveAccessors(JsonTargetObject);
 				}
 			}
 		}
+	}
+
+	FThreadSafeBool bFailed = false;
+	ParallelFor(JsonPrimitiveObjects.Num(), [&](const int32 PrimitiveIndex)
+		{
+			if (!LoadPrimitiveGeometry(JsonPrimitiveObjects[PrimitiveIndex], DecodedPrimitives[PrimitiveIndex]))
+			{
+				bFailed = true;
+			}
+		});
+
+	if (bFailed)
+	{
+		return false;
+	}
 
-		Primitives = MergedPrimitives;
+	const bool bDeferMaterials = !IsInGameThread();
+	for (int32 PrimitiveIndex = 0; PrimitiveIndex < JsonPrimitiveObjects.Num(); PrimitiveIndex++)
+	{
+		FglTFRuntimePrimitive& Primitive = DecodedPrimitives[PrimitiveIndex];
+		// materials (and textures) are UObjects, off the game thread only collect the index
+		// and let the async continuation (FinalizeStaticMesh, FinalizeSkeletalMeshWithLODs...) load them
+		if (bDeferMaterials)
+		{
+			Primitive.MaterialIndex = GetPrimitiveMaterialIndex(JsonPrimitiveObjects[PrimitiveIndex], MaterialsConfig);
+			Primitive.Material = UMaterial::GetDefaultMaterial(MD_Surface);
+			Primitive.bMaterialPending = !MaterialsConfig.bSkipLoad;
+		}
+		else if (!LoadPrimitiveMaterial(JsonPrimitiveObjects[PrimitiveIndex], Primitive, MaterialsConfig))
+		{
+			return false;
+		}
+		OnLoadedPrimitive.Broadcast(AsShared(), JsonPrimitiveObjects[PrimitiveIndex], Primitive);
+	}
 
+	for (FglTFRuntimePrimitive& Primitive : DecodedPrimitives)
+	{
+		// add the primitive only if it has at least one index 
+		if (Primitive.Indices.Num() > 0)
+		{
+			Primitives.Add(MoveTemp(Primitive));
+		}
 	}
 
 	return true;
@@ -2556,6 +3283,25 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 	OnPreLoadedPrimitive.Broadcast(AsShared(), JsonPrimitiveObject, Primitive);
 
+	if (!LoadPrimitiveGeometry(JsonPrimitiveObject, Primitive))
+	{
+		return false;
+	}
+
+	if (!LoadPrimitiveMaterial(JsonPrimitiveObject, Primitive, MaterialsConfig))
+	{
+		return false;
+	}
+
+	OnLoadedPrimitive.Broadcast(AsShared(), JsonPrimitiveObject, Primitive);
+
+	return true;
+}
+
+bool FglTFRuntimeParser::LoadPrimitiveGeometry(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_LoadPrimitiveGeometry, FColor::Magenta);
+
 	if (!JsonPrimitiveObject->TryGetNumberField("mode", Primitive.Mode))
 	{
 		Primitive.Mode = 4; // triangles
@@ -2590,8 +3336,12 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		SupportedTexCoordComponentTypes.Append({ 5120, 5122 });
 	}
 
+	// basis change and scene scale fused in a single matrix, float accessors are converted and transformed in a single pass
+	const FAccessorAffineTransform PositionsTransform(SceneBasis * FScaleMatrix(SceneScale), true);
+	const FAccessorAffineTransform NormalsTransform(SceneBasis, false);
+
 	if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "POSITION", Primitive.Positions,
-		{ 3 }, SupportedPositionComponentTypes, [&](FVector Value) -> FVector {return SceneBasis.TransformPosition(Value) * SceneScale; }, Primitive.AdditionalBufferView, false, nullptr))
+		{ 3 }, SupportedPositionComponentTypes, PositionsTransform, Primitive.AdditionalBufferView, false, nullptr))
 	{
 		AddError("LoadPrimitive()", "Unable to load POSITION attribute");
 		return false;
@@ -2600,7 +3350,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 	if ((*JsonAttributesObject)->HasField("NORMAL"))
 	{
 		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "NORMAL", Primitive.Normals,
-			{ 3 }, SupportedNormalComponentTypes, [&](FVector Value) -> FVector { return SceneBasis.TransformVector(Value); }, Primitive.AdditionalBufferView, true, nullptr))
+			{ 3 }, SupportedNormalComponentTypes, NormalsTransform, Primitive.AdditionalBufferView, true, nullptr))
 		{
 			AddError("LoadPrimitive()", "Unable to load NORMAL attribute");
 			return false;
@@ -2622,7 +3372,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		TArray<FVector2D> UV;
 		int64 TexCoordComponentType = 0;
 		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TEXCOORD_0", UV,
-			{ 2 }, SupportedTexCoordComponentTypes, [&](FVector2D Value) -> FVector2D {return FVector2D(Value.X, Value.Y); }, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType))
+			{ 2 }, SupportedTexCoordComponentTypes, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType))
 		{
 			AddError("LoadPrimitive()", "Error loading TEXCOORD_0");
 			return false;
@@ -2641,7 +3391,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		TArray<FVector2D> UV;
 		int64 TexCoordComponentType = 0;
 		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TEXCOORD_1", UV,
-			{ 2 }, SupportedTexCoordComponentTypes, [&](FVector2D Value) -> FVector2D {return FVector2D(Value.X, Value.Y); }, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType))
+			{ 2 }, SupportedTexCoordComponentTypes, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType))
 		{
 			AddError("LoadPrimitive()", "Error loading TEXCOORD_1");
 			return false;
@@ -2761,6 +3511,26 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		}
 	}
 
+	// point clouds can carry per point data (intensity, classification, ...) as custom attributes
+	if (Primitive.Mode == 0) // points
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*JsonAttributesObject)->Values)
+		{
+			if (!Pair.Key.StartsWith("_"))
+			{
+				continue;
+			}
+
+			TArray<float> Values;
+			// non scalar custom attributes are not supported, just skip them
+			if (BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), Pair.Key, Values,
+				{ 5126, 5120, 5121, 5122, 5123 }, Primitive.AdditionalBufferView, false, nullptr))
+			{
+				Primitive.CustomAttributes.Add(Pair.Key, MoveTemp(Values));
+			}
+		}
+	}
+
 	const TArray<TSharedPtr<FJsonValue>>* JsonTargetsArray;
 	if (JsonPrimitiveObject->TryGetArrayField("targets", JsonTargetsArray))
 	{
@@ -2780,7 +3550,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 			if (JsonTargetObject->HasField("POSITION"))
 			{
 				if (!BuildFromAccessorField(JsonTargetObject.ToSharedRef(), "POSITION", MorphTarget.Positions,
-					{ 3 }, SupportedPositionComponentTypes, [&](FVector Value) -> FVector { return SceneBasis.TransformPosition(Value) * SceneScale; }, INDEX_NONE, false, nullptr))
+					{ 3 }, SupportedPositionComponentTypes, PositionsTransform, INDEX_NONE, false, nullptr))
 				{
 					AddError("LoadPrimitive()", "Unable to load POSITION attribute for MorphTarget");
 					return false;
@@ -2796,7 +3566,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 			if (JsonTargetObject->HasField("NORMAL"))
 			{
 				if (!BuildFromAccessorField(JsonTargetObject.ToSharedRef(), "NORMAL", MorphTarget.Normals,
-					{ 3 }, SupportedNormalComponentTypes, [&](FVector Value) -> FVector { return SceneBasis.TransformVector(Value); }, INDEX_NONE, true, nullptr))
+					{ 3 }, SupportedNormalComponentTypes, NormalsTransform, INDEX_NONE, true, nullptr))
 				{
 					AddError("LoadPrimitive()", "Unable to load NORMAL attribute for MorphTarget");
 					return false;
@@ -2839,33 +3609,49 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 			return false;
 		}
 
-		Primitive.Indices.AddUninitialized(Count);
-		for (int64 i = 0; i < Count; i++)
+		if (ComponentType != 5121 && ComponentType != 5123 && ComponentType != 5125)
 		{
-			int64 IndexIndex = i * Stride;
+			AddError("LoadPrimitive()", FString::Printf(TEXT("Invalid component type for indices: %lld"), ComponentType));
+			return false;
+		}
 
-			uint32 VertexIndex;
-			if (ComponentType == 5121)
-			{
-				VertexIndex = IndicesBytes.Data[IndexIndex];
-			}
-			else if (ComponentType == 5123)
+		Primitive.Indices.AddUninitialized(Count);
+		uint32* IndicesData = Primitive.Indices.GetData();
+
+		// tightly packed 32bit indices can be copied straight away
+		if (ComponentType == 5125 && Stride == sizeof(uint32))
+		{
+			FMemory::Memcpy(IndicesData, IndicesBytes.Data, Count * sizeof(uint32));
+		}
+		else if (ComponentType == 5125)
+		{
+			for (int64 i = 0; i < Count; i++)
 			{
-				uint16* IndexPtr = (uint16*)&(IndicesBytes.Data[IndexIndex]);
-				VertexIndex = *IndexPtr;
+				IndicesData[i] = *reinterpret_cast<const uint32*>(IndicesBytes.Data + i * Stride);
 			}
-			else if (ComponentType == 5125)
+		}
+		// tightly packed 16bit and 8bit indices are widened in a single contiguous pass
+		else if (ComponentType == 5123 && Stride == sizeof(uint16))
+		{
+			WidenIndices(reinterpret_cast<const uint16*>(IndicesBytes.Data), Count, IndicesData);
+		}
+		else if (ComponentType == 5121 && Stride == sizeof(uint8))
+		{
+			WidenIndices(IndicesBytes.Data, Count, IndicesData);
+		}
+		else if (ComponentType == 5123)
+		{
+			for (int64 i = 0; i < Count; i++)
 			{
-				uint32* IndexPtr = (uint32*)&(IndicesBytes.Data[IndexIndex]);
-				VertexIndex = *IndexPtr;
+				IndicesData[i] = *reinterpret_cast<const uint16*>(IndicesBytes.Data + i * Stride);
 			}
-			else
+		}
+		else
+		{
+			for (int64 i = 0; i < Count; i++)
 			{
-				AddError("LoadPrimitive()", FString::Printf(TEXT("Invalid component type for indices: %lld"), ComponentType));
-				return false;
+				IndicesData[i] = IndicesBytes.Data[i * Stride];
 			}
-
-			Primitive.Indices[i] = VertexIndex;
 		}
 	}
 	else
@@ -2919,66 +3705,104 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		Primitive.Indices = FanIndices;
 	}
 
-	Primitive.Material = UMaterial::GetDefaultMaterial(MD_Surface);
+	return true;
+}
+
+bool FglTFRuntimeParser::LoadPrimitiveMaterial(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+{
+	Primitive.MaterialIndex = GetPrimitiveMaterialIndex(JsonPrimitiveObject, MaterialsConfig);
+	Primitive.Material = LoadPrimitiveMaterial(Primitive.MaterialIndex, Primitive.Colors.Num() > 0, MaterialsConfig, Primitive.MaterialName);
+	if (!Primitive.Material)
+	{
+		return false;
+	}
+	Primitive.bHasMaterial = Primitive.MaterialIndex != INDEX_NONE;
+	Primitive.bMaterialPending = false;
+
+	return true;
+}
+
+int64 FglTFRuntimeParser::GetPrimitiveMaterialIndex(TSharedRef<FJsonObject> JsonPrimitiveObject, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+{
+	if (MaterialsConfig.bSkipLoad)
+	{
+		return INDEX_NONE;
+	}
 
-	if (!MaterialsConfig.bSkipLoad)
+	int64 MaterialIndex = INDEX_NONE;
+	if (!MaterialsConfig.Variant.IsEmpty() && MaterialsVariants.Contains(MaterialsConfig.Variant))
 	{
-		int64 MaterialIndex = INDEX_NONE;
-		if (!MaterialsConfig.Variant.IsEmpty() && MaterialsVariants.Contains(MaterialsConfig.Variant))
+		int32 WantedIndex = MaterialsVariants.IndexOfByKey(MaterialsConfig.Variant);
+		TArray<TSharedRef<FJsonObject>> VariantsMappings = GetJsonObjectArrayFromExtension(JsonPrimitiveObject, "KHR_materials_variants", "mappings");
+		for (TSharedRef<FJsonObject> VariantsMapping : VariantsMappings)
 		{
-			int32 WantedIndex = MaterialsVariants.IndexOfByKey(MaterialsConfig.Variant);
-			TArray<TSharedRef<FJsonObject>> VariantsMappings = GetJsonObjectArrayFromExtension(JsonPrimitiveObject, "KHR_materials_variants", "mappings");
-			bool bMappingFound = false;
-			for (TSharedRef<FJsonObject> VariantsMapping : VariantsMappings)
+			const TArray<TSharedPtr<FJsonValue>>* Variants;
+			if (VariantsMapping->TryGetArrayField("variants", Variants))
 			{
-				const TArray<TSharedPtr<FJsonValue>>* Variants;
-				if (VariantsMapping->TryGetArrayField("variants", Variants))
+				for (TSharedPtr<FJsonValue> Variant : (*Variants))
 				{
-					for (TSharedPtr<FJsonValue> Variant : (*Variants))
+					int64 VariantIndex;
+					if (Variant->TryGetNumber(VariantIndex) && VariantIndex == WantedIndex)
 					{
-						int64 VariantIndex;
-						if (Variant->TryGetNumber(VariantIndex) && VariantIndex == WantedIndex)
-						{
-							MaterialIndex = VariantsMapping->GetNumberField("material");
-							bMappingFound = true;
-							break;
-						}
+						return VariantsMapping->GetNumberField("material");
 					}
 				}
-				if (bMappingFound)
-				{
-					break;
-				}
 			}
 		}
+	}
+
+	if (!JsonPrimitiveObject->TryGetNumberField("material", MaterialIndex))
+	{
+		MaterialIndex = INDEX_NONE;
+	}
+
+	return MaterialIndex;
+}
+
+UMaterialInterface* FglTFRuntimeParser::LoadPrimitiveMaterial(const int64 MaterialIndex, const bool bUseVertexColors, const FglTFRuntimeMaterialsConfig& MaterialsConfig, FString& MaterialName)
+{
+	if (MaterialsConfig.bSkipLoad)
+	{
+		return UMaterial::GetDefaultMaterial(MD_Surface);
+	}
 
-		if (MaterialIndex == INDEX_NONE)
+	if (MaterialIndex != INDEX_NONE)
+	{
+		UMaterialInterface* Material = LoadMaterial(MaterialIndex, MaterialsConfig, bUseVertexColors, MaterialName);
+		if (!Material)
 		{
-			if (!JsonPrimitiveObject->TryGetNumberField("material", MaterialIndex))
-			{
-				MaterialIndex = INDEX_NONE;
-			}
+			AddError("LoadPrimitive()", FString::Printf(TEXT("Unable to load material %lld"), MaterialIndex));
 		}
+		return Material;
+	}
+
+	// special case for primitives without a material but with a color buffer
+	if (bUseVertexColors)
+	{
+		return BuildVertexColorOnlyMaterial(MaterialsConfig);
+	}
 
-		if (MaterialIndex != INDEX_NONE)
+	return UMaterial::GetDefaultMaterial(MD_Surface);
+}
+
+bool FglTFRuntimeParser::ResolvePendingMaterials(FglTFRuntimeMeshLOD& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+{
+	for (FglTFRuntimePrimitive& Primitive : LOD.Primitives)
+	{
+		if (!Primitive.bMaterialPending)
 		{
-			Primitive.Material = LoadMaterial(MaterialIndex, MaterialsConfig, Primitive.Colors.Num() > 0, Primitive.MaterialName);
-			if (!Primitive.Material)
-			{
-				AddError("LoadPrimitive()", FString::Printf(TEXT("Unable to load material %lld"), MaterialIndex));
-				return false;
-			}
-			Primitive.bHasMaterial = true;
+			continue;
 		}
-		// special case for primitives without a material but with a color buffer
-		else if (Primitive.Colors.Num() > 0)
+
+		Primitive.Material = LoadPrimitiveMaterial(Primitive.MaterialIndex, Primitive.Colors.Num() > 0, MaterialsConfig, Primitive.MaterialName);
+		if (!Primitive.Material)
 		{
-			Primitive.Material = BuildVertexColorOnlyMaterial(MaterialsConfig);
+			return false;
 		}
+		Primitive.bHasMaterial = Primitive.MaterialIndex != INDEX_NONE;
+		Primitive.bMaterialPending = false;
 	}
 
-	OnLoadedPrimitive.Broadcast(AsShared(), JsonPrimitiveObject, Primitive);
-
 	return true;
 }
 
@@ -2990,6 +3814,12 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		return false;
 	}
 
+	if (Index == 0 && BinaryChunk.Data)
+	{
+		Blob = BinaryChunk;
+		return true;
+	}
+
 	if (Index == 0 && BinaryBuffer.Num() > 0)
 	{
 		Blob.Data = BinaryBuffer.GetData();
@@ -2998,10 +3828,8 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 	}
 
 	// first check cache
-	if (BuffersCache.Contains(Index))
+	if (FindCachedBuffer(Index, Blob))
 	{
-		Blob.Data = BuffersCache[Index].GetData();
-		Blob.Num = BuffersCache[Index].Num();
 		return true;
 	}
 
@@ -3042,9 +3870,7 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		TArray64<uint8> Base64Data;
 		if (ParseBase64Uri(Uri, Base64Data))
 		{
-			BuffersCache.Add(Index, Base64Data);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+			CacheBuffer(Index, MoveTemp(Base64Data), Blob);
 			return true;
 		}
 		return false;
@@ -3053,18 +3879,13 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 	// Data supplied via TCP has previously been placed in AuxilliaryData.
 	if (AuxilliaryData.Num() != 0) 
 	{
-		if (FBinaryData* Data = AuxilliaryData.Find(Uri)) 
-		{
-			// Note: Currently, Data->data is getting copied.
-			// Initialising data as TArray64 from the start would be better.
-			// (although there is very little documentation about TArray64)
-			// Alternatively, converting the allocator from uint32 to uint64?
-			// I'm not currently sure how that works.
-			TArray64<uint8> DataToAdd;
-			DataToAdd.Append(Data->data);
-			BuffersCache.Add(Index, DataToAdd); 
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+		if (const TSharedRef<const FBinaryData, ESPMode::ThreadSafe>* Data = AuxilliaryData.Find(Uri))
+		{
+			// the blob references the aux bytes directly, the cache just keeps them alive
+			FWriteScopeLock Lock(BuffersCacheLock);
+			AuxBuffersCache.Add(Index, *Data);
+			Blob.Data = const_cast<uint8*>((*Data)->GetData());
+			Blob.Num = (*Data)->Num();
 			return true;
 		}
 		UE_LOG(LogTemp, Log,
@@ -3076,9 +3897,7 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		TArray64<uint8> ZipData;
 		if (ZipFile->GetFileContent(Uri, ZipData))
 		{
-			BuffersCache.Add(Index, ZipData);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+			CacheBuffer(Index, MoveTemp(ZipData), Blob);
 			return true;
 		}
 	}
@@ -3086,12 +3905,39 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 	// fallback
 	if (!BaseDirectory.IsEmpty())
 	{
+		const FString Filename = FPaths::Combine(BaseDirectory, Uri);
+
+		// external files are mapped (pages are loaded on demand), platforms without mapping support will read them
+		if (bMapExternalFiles)
+		{
+			TSharedPtr<FglTFRuntimeMappedBuffer> MappedBuffer = MakeShared<FglTFRuntimeMappedBuffer>();
+			MappedBuffer->Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+			if (MappedBuffer->Handle && MappedBuffer->Handle->GetFileSize() > 0)
+			{
+				MappedBuffer->Region.Reset(MappedBuffer->Handle->MapRegion(0, MappedBuffer->Handle->GetFileSize()));
+				if (MappedBuffer->Region)
+				{
+					FWriteScopeLock Lock(BuffersCacheLock);
+					// another thread may have mapped the same file in the meantime
+					if (TSharedPtr<FglTFRuntimeMappedBuffer>* CachedMappedBuffer = MappedBuffersCache.Find(Index))
+					{
+						MappedBuffer = *CachedMappedBuffer;
+					}
+					else
+					{
+						MappedBuffersCache.Add(Index, MappedBuffer);
+					}
+					Blob.Data = const_cast<uint8*>(MappedBuffer->Region->GetMappedPtr());
+					Blob.Num = MappedBuffer->Region->GetMappedSize();
+					return true;
+				}
+			}
+		}
+
 		TArray64<uint8> FileData;
-		if (FFileHelper::LoadFileToArray(FileData, *FPaths::Combine(BaseDirectory, Uri)))
+		if (FFileHelper::LoadFileToArray(FileData, *Filename))
 		{
-			BuffersCache.Add(Index, FileData);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+			CacheBuffer(Index, MoveTemp(FileData), Blob);
 			return true;
 		}
 	}
@@ -3100,6 +3946,49 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 	return false;
 }
 
+bool FglTFRuntimeParser::FindCachedBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
+{
+	FReadScopeLock Lock(BuffersCacheLock);
+
+	if (const TArray64<uint8>* CachedData = BuffersCache.Find(Index))
+	{
+		Blob.Data = const_cast<uint8*>(CachedData->GetData());
+		Blob.Num = CachedData->Num();
+		return true;
+	}
+
+	if (const TSharedPtr<FglTFRuntimeMappedBuffer>* MappedBuffer = MappedBuffersCache.Find(Index))
+	{
+		Blob.Data = const_cast<uint8*>((*MappedBuffer)->Region->GetMappedPtr());
+		Blob.Num = (*MappedBuffer)->Region->GetMappedSize();
+		return true;
+	}
+
+	if (const TSharedPtr<const FBinaryData, ESPMode::ThreadSafe>* AuxData = AuxBuffersCache.Find(Index))
+	{
+		Blob.Data = const_cast<uint8*>((*AuxData)->GetData());
+		Blob.Num = (*AuxData)->Num();
+		return true;
+	}
+
+	return false;
+}
+
+void FglTFRuntimeParser::CacheBuffer(const int32 Index, TArray64<uint8>&& Data, FglTFRuntimeBlob& Blob)
+{
+	FWriteScopeLock Lock(BuffersCacheLock);
+
+	// the first decoder wins, concurrent loads of the same buffer just drop their copy
+	TArray64<uint8>* CachedData = BuffersCache.Find(Index);
+	if (!CachedData)
+	{
+		CachedData = &BuffersCache.Add(Index, MoveTemp(Data));
+	}
+
+	Blob.Data = CachedData->GetData();
+	Blob.Num = CachedData->Num();
+}
+
 bool FglTFRuntimeParser::ParseBase64Uri(const FString& Uri, TArray64<uint8>& Bytes)
 {
 	const FString Base64Signature = ";base64,";
@@ -3133,10 +4022,11 @@ bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob
 	if (JsonBufferViewCompressedObject)
 	{
 		JsonBufferViewObject = JsonBufferViewCompressedObject;
-		if (CompressedBufferViewsCache.Contains(Index))
+		FReadScopeLock Lock(CompressedBufferViewsCacheLock);
+		if (TArray64<uint8>* CachedData = CompressedBufferViewsCache.Find(Index))
 		{
-			Blob.Data = CompressedBufferViewsCache[Index].GetData();
-			Blob.Num = CompressedBufferViewsCache[Index].Num();
+			Blob.Data = CachedData->GetData();
+			Blob.Num = CachedData->Num();
 			Stride = CompressedBufferViewsStridesCache[Index];
 			return true;
 		}
@@ -3202,15 +4092,23 @@ bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob
 			MeshOptFilter = "NONE";
 		}
 
-		CompressedBufferViewsCache.Add(Index);
-		if (!DecompressMeshOptimizer(Blob, Stride, Elements, MeshOptMode, MeshOptFilter, CompressedBufferViewsCache[Index]))
+		// decompress outside of the lock, concurrent decoders of the same view keep the first result
+		TArray64<uint8> DecompressedData;
+		if (!DecompressMeshOptimizer(Blob, Stride, Elements, MeshOptMode, MeshOptFilter, DecompressedData))
 		{
-			CompressedBufferViewsCache.Remove(Index);
 			return false;
 		}
-		Blob.Data = CompressedBufferViewsCache[Index].GetData();
-		Blob.Num = CompressedBufferViewsCache[Index].Num();
-		CompressedBufferViewsStridesCache.Add(Index, Stride);
+
+		FWriteScopeLock Lock(CompressedBufferViewsCacheLock);
+		TArray64<uint8>* CachedData = CompressedBufferViewsCache.Find(Index);
+		if (!CachedData)
+		{
+			CachedData = &CompressedBufferViewsCache.Add(Index, MoveTemp(DecompressedData));
+			CompressedBufferViewsStridesCache.Add(Index, Stride);
+		}
+		Blob.Data = CachedData->GetData();
+		Blob.Num = CachedData->Num();
+		Stride = CompressedBufferViewsStridesCache[Index];
 	}
 
 	return true;
@@ -3304,12 +4202,16 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 	}
 	else if (bInitWithZeros)
 	{
-
-		if (ZeroBuffer.Num() < FinalSize)
 		{
-			ZeroBuffer.AddZeroed(FinalSize - ZeroBuffer.Num());
+			FScopeLock Lock(&ZeroBuffersLock);
+			// never grow in place, other decoders may still be reading the current buffer
+			if (ZeroBuffers.Num() == 0 || ZeroBuffers.Last().Num() < FinalSize)
+			{
+				TArray64<uint8>& ZeroBuffer = ZeroBuffers.AddDefaulted_GetRef();
+				ZeroBuffer.AddZeroed(FMath::Max<int64>(FinalSize, ZeroBuffers.Num() > 1 ? ZeroBuffers[ZeroBuffers.Num() - 2].Num() * 2 : 0));
+			}
+			Blob.Data = ZeroBuffers.Last().GetData();
 		}
-		Blob.Data = ZeroBuffer.GetData();
 		Blob.Num = FinalSize;
 		if (!bHasSparse)
 		{
@@ -3355,12 +4257,15 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		}
 	}
 
-	if (SparseAccessorsCache.Contains(Index))
 	{
-		Stride = SparseAccessorsStridesCache[Index];
-		Blob.Data = SparseAccessorsCache[Index].GetData();
-		Blob.Num = SparseAccessorsCache[Index].Num();
-		return true;
+		FReadScopeLock Lock(SparseAccessorsCacheLock);
+		if (TArray64<uint8>* CachedData = SparseAccessorsCache.Find(Index))
+		{
+			Stride = SparseAccessorsStridesCache[Index];
+			Blob.Data = CachedData->GetData();
+			Blob.Num = CachedData->Num();
+			return true;
+		}
 	}
 
 	int64 SparseCount;
@@ -3477,9 +4382,7 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 
 	Stride = SparseBufferViewValuesStride;
 
-	SparseAccessorsCache.Add(Index);
-	SparseAccessorsStridesCache.Add(Index, Stride);
-	TArray64<uint8>& SparseData = SparseAccessorsCache[Index];
+	TArray64<uint8> SparseData;
 	SparseData.Append(Blob.Data, Blob.Num);
 
 	for (int32 IndexToChange = 0; IndexToChange < SparseCount; IndexToChange++)
@@ -3495,7 +4398,15 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		FMemory::Memcpy(OriginalValuePtr, NewValuePtr, SparseBufferViewValuesStride);
 	}
 
-	Blob.Data = SparseData.GetData();
+	FWriteScopeLock Lock(SparseAccessorsCacheLock);
+	TArray64<uint8>* CachedData = SparseAccessorsCache.Find(Index);
+	if (!CachedData)
+	{
+		CachedData = &SparseAccessorsCache.Add(Index, MoveTemp(SparseData));
+		SparseAccessorsStridesCache.Add(Index, Stride);
+	}
+
+	Blob.Data = CachedData->GetData();
 
 	return true;
 }
@@ -3562,7 +4473,10 @@ void FglTFRuntimeParser::ClearCache()
 	MaterialsCache.Empty();
 	SkeletonsCache.Empty();
 	SkeletalMeshesCache.Empty();
-	TexturesCache.Empty();
+	{
+		FWriteScopeLock Lock(TexturesCacheLock);
+		TexturesCache.Empty();
+	}
 	MetallicRoughnessMaterialsMap.Empty();
 	SpecularGlossinessMaterialsMap.Empty();
 	UnlitMaterialsMap.Empty();
@@ -3661,6 +4575,8 @@ bool FglTFRuntimeParser::MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePri
 	for (FglTFRuntimePrimitive& SourcePrimitive : SourcePrimitives)
 	{
 		OutPrimitive.Material = SourcePrimitive.Material;
+		OutPrimitive.MaterialIndex = SourcePrimitive.MaterialIndex;
+		OutPrimitive.bMaterialPending = SourcePrimitive.bMaterialPending;
 
 		// TODO the logic here is available only for staticmeshes loaded as skeletal ones.
 		// It should be improved to support plain recursive loading of skeletalmeshes
@@ -3980,11 +4896,11 @@ bool FglTFRuntimeParser::GetJsonObjectBytes(TSharedRef<FJsonObject> JsonObject,
 			if (AuxilliaryData.Num() != 0) {
 				UE_LOG(LogTemp, Log, TEXT("Uri: (%s)"), *Uri);
 
-				if (FBinaryData* Data = AuxilliaryData.Find(Uri)) {
+				if (const TSharedRef<const FBinaryData, ESPMode::ThreadSafe>* Data = AuxilliaryData.Find(Uri)) {
 					UE_LOG(LogTemp, Log,
 						TEXT("Uri has been found."));
 
-					Bytes.Append(Data->data);
+					Bytes.Append((*Data)->GetData(), (*Data)->Num());
 					bFound = true;
 				}
 				else {
@@ -4037,6 +4953,31 @@ bool FglTFRuntimeParser::GetJsonObjectBytes(TSharedRef<FJsonObject> JsonObject,
 	return Bytes.Num() > 0;
 }
 
+bool FglTFRuntimeParser::GetJsonObjectBytes(TSharedRef<FJsonObject> JsonObject, TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe>& SharedBytes)
+{
+	FString Uri;
+	if (JsonObject->TryGetStringField("uri", Uri))
+	{
+		if (const TSharedRef<const FBinaryData, ESPMode::ThreadSafe>* Data = AuxilliaryData.Find(Uri))
+		{
+			if ((*Data)->SharedData)
+			{
+				SharedBytes = (*Data)->SharedData;
+				return SharedBytes->Num() > 0;
+			}
+		}
+	}
+
+	TSharedRef<TArray64<uint8>, ESPMode::ThreadSafe> Bytes = MakeShared<TArray64<uint8>, ESPMode::ThreadSafe>();
+	if (!GetJsonObjectBytes(JsonObject, *Bytes))
+	{
+		return false;
+	}
+
+	SharedBytes = Bytes;
+	return true;
+}
+
 FVector FglTFRuntimeParser::ComputeTangentY(const FVector Normal, const FVector TangetX)
 {
 	float Determinant = GetBasisDeterminantSign(Normal.GetSafeNormal(),
@@ -5018,22 +5959,63 @@ void FglTFRuntimeParser::LoadMeshAsRuntimeLODAsync(const int32 MeshIndex, const
 	if (!JsonMeshObject)
 	{
 		AsyncCallback.ExecuteIfBound(false, FglTFRuntimeMeshLOD());
+		return;
 	}
 
-	Async(EAsyncExecution::Thread, [this, JsonMeshObject, MaterialsConfig, AsyncCallback]()
+	TSharedRef<FglTFRuntimeLODsPin, ESPMode::ThreadSafe> LODsPin = MakeShared<FglTFRuntimeLODsPin, ESPMode::ThreadSafe>(AsShared());
+
+	RunOnWorkerPool([this, JsonMeshObject, MaterialsConfig, AsyncCallback, LODsPin]()
 		{
 			FglTFRuntimeMeshLOD* LOD;
 			bool bSuccess = LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, MaterialsConfig);
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, LOD, AsyncCallback]()
+			// the pin keeps the cached LOD alive even if the asset is updated in the meantime
+			RunOnGameThread([Parser = AsShared(), bSuccess, LOD, MaterialsConfig, AsyncCallback, LODsPin]()
 				{
-					AsyncCallback.ExecuteIfBound(bSuccess, bSuccess ? *LOD : FglTFRuntimeMeshLOD());
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+					bool bResolved = bSuccess && Parser->ResolvePendingMaterials(*LOD, MaterialsConfig);
+					AsyncCallback.ExecuteIfBound(bResolved, bResolved ? *LOD : FglTFRuntimeMeshLOD());
+				});
 		}
 
 	);
 }
 
+void FglTFRuntimeParser::RunOnWorkerPool(TUniqueFunction<void()>&& Work, const EglTFRuntimeAsyncPriority Priority)
+{
+	FQueuedThreadPool* WorkerPool = FglTFRuntimeModule::GetWorkerPool();
+	if (!WorkerPool)
+	{
+		// the module has not been started (or it is shutting down)
+		WorkerPool = GThreadPool;
+	}
+
+	if (!WorkerPool)
+	{
+		Work();
+		return;
+	}
+
+#if ENGINE_MAJOR_VERSION > 4
+	EQueuedWorkPriority QueuedWorkPriority = EQueuedWorkPriority::Normal;
+	if (Priority == EglTFRuntimeAsyncPriority::High)
+	{
+		QueuedWorkPriority = EQueuedWorkPriority::High;
+	}
+	else if (Priority == EglTFRuntimeAsyncPriority::Low)
+	{
+		QueuedWorkPriority = EQueuedWorkPriority::Low;
+	}
+	AsyncPool(*WorkerPool, MoveTemp(Work), nullptr, QueuedWorkPriority);
+#else
+	// UE4 pools are FIFO only
+	AsyncPool(*WorkerPool, MoveTemp(Work));
+#endif
+}
+
+void FglTFRuntimeParser::RunOnGameThread(TUniqueFunction<void()>&& Work)
+{
+	AsyncTask(ENamedThreads::GameThread, MoveTemp(Work));
+}
+
 bool FglTFRuntimeParser::LoadPathToBlob(const FString& Path, TArray64<uint8>& Blob)
 {
 	if (IsArchive())
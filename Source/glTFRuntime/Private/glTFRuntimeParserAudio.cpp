@@ -42,11 +42,11 @@ bool FglTFRuntimeParser::LoadAudioEmitter(const int32 EmitterIndex, FglTFRuntime
 		{
 			if (TSharedPtr<FJsonObject> JsonClip = GetJsonObjectFromRootExtensionIndex("MSFT_audio_emitter", "clips", ClipIndex))
 			{
-				TArray64<uint8> Bytes;
+				TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> Bytes;
 				if (GetJsonObjectBytes(JsonClip.ToSharedRef(), Bytes))
 				{
 					FWaveModInfo WaveModInfo;
-					if (WaveModInfo.ReadWaveInfo(Bytes.GetData(), Bytes.Num()))
+					if (WaveModInfo.ReadWaveInfo(Bytes->GetData(), Bytes->Num()))
 					{
 						UglTFRuntimeSoundWave* RuntimeSound = NewObject<UglTFRuntimeSoundWave>(GetTransientPackage(), NAME_None, RF_Public);
 
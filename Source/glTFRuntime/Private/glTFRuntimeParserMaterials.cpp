@@ -16,8 +16,259 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Math/UnrealMathUtility.h"
 #include "Modules/ModuleManager.h"
+#include "Async/ParallelFor.h"
 #include "TextureResource.h"
 
+namespace glTFRuntimeMips
+{
+	// source texels (and their weights) contributing to a destination texel along one axis
+	struct FTaps
+	{
+		int32 Index[3];
+		float Weight[3];
+		int32 Num;
+	};
+
+	static void ComputeTaps(const int32 SrcSize, const int32 DstSize, TArray<FTaps>& Taps)
+	{
+		Taps.SetNumUninitialized(DstSize);
+		for (int32 Dst = 0; Dst < DstSize; Dst++)
+		{
+			FTaps& Tap = Taps[Dst];
+			if (SrcSize == 1)
+			{
+				Tap.Num = 1;
+				Tap.Index[0] = 0;
+				Tap.Weight[0] = 1;
+			}
+			else if ((SrcSize % 2) == 0)
+			{
+				Tap.Num = 2;
+				Tap.Index[0] = Dst * 2;
+				Tap.Index[1] = Dst * 2 + 1;
+				Tap.Weight[0] = 0.5f;
+				Tap.Weight[1] = 0.5f;
+			}
+			else
+			{
+				// odd sizes use the polyphase box filter, so every source texel is covered
+				Tap.Num = 3;
+				Tap.Index[0] = Dst * 2;
+				Tap.Index[1] = Dst * 2 + 1;
+				Tap.Index[2] = Dst * 2 + 2;
+				Tap.Weight[0] = static_cast<float>(DstSize - Dst) / SrcSize;
+				Tap.Weight[1] = static_cast<float>(DstSize) / SrcSize;
+				Tap.Weight[2] = static_cast<float>(Dst + 1) / SrcSize;
+			}
+		}
+	}
+
+	// 8 bit <-> linear lookup tables, the linear values are quantized to 12 bits when encoding back
+	struct FColorTables
+	{
+		static constexpr int32 LinearSteps = 4096;
+
+		float SRGBToLinear[256];
+		float UNormToLinear[256];
+		uint8 LinearToSRGB[LinearSteps];
+		uint8 LinearToUNorm[LinearSteps];
+
+		FColorTables()
+		{
+			for (int32 Value = 0; Value < 256; Value++)
+			{
+				SRGBToLinear[Value] = FLinearColor::FromSRGBColor(FColor(Value, 0, 0)).R;
+				UNormToLinear[Value] = Value / 255.0f;
+			}
+
+			for (int32 Step = 0; Step < LinearSteps; Step++)
+			{
+				const float Linear = static_cast<float>(Step) / (LinearSteps - 1);
+				LinearToSRGB[Step] = FLinearColor(Linear, 0, 0).ToFColor(true).R;
+				LinearToUNorm[Step] = static_cast<uint8>(FMath::RoundToInt(Linear * 255.0f));
+			}
+		}
+
+		static const FColorTables& Get()
+		{
+			static const FColorTables Tables;
+			return Tables;
+		}
+	};
+
+	// builds a mip level (FColor/PF_B8G8R8A8) from the previous one
+	static void Downsample(const FColor* Src, const int32 SrcWidth, const int32 SrcHeight, FColor* Dst, const int32 DstWidth, const int32 DstHeight, const bool sRGB)
+	{
+		const FColorTables& Tables = FColorTables::Get();
+		// per byte tables (B, G, R, A), alpha is always linear
+		const float* ToLinear[4] = { Tables.UNormToLinear, Tables.UNormToLinear, Tables.UNormToLinear, Tables.UNormToLinear };
+		const uint8* FromLinear[4] = { Tables.LinearToUNorm, Tables.LinearToUNorm, Tables.LinearToUNorm, Tables.LinearToUNorm };
+		if (sRGB)
+		{
+			ToLinear[0] = ToLinear[1] = ToLinear[2] = Tables.SRGBToLinear;
+			FromLinear[0] = FromLinear[1] = FromLinear[2] = Tables.LinearToSRGB;
+		}
+
+		// fast path: 2x2 average
+		if ((SrcWidth % 2) == 0 && (SrcHeight % 2) == 0)
+		{
+			const uint8* SrcBytes = reinterpret_cast<const uint8*>(Src);
+			uint8* DstBytes = reinterpret_cast<uint8*>(Dst);
+			const int64 SrcPitch = static_cast<int64>(SrcWidth) * 4;
+			for (int32 Y = 0; Y < DstHeight; Y++)
+			{
+				const uint8* Row0 = SrcBytes + SrcPitch * (Y * 2);
+				const uint8* Row1 = Row0 + SrcPitch;
+				uint8* DstRow = DstBytes + static_cast<int64>(DstWidth) * 4 * Y;
+				if (!sRGB)
+				{
+					for (int32 X = 0; X < DstWidth * 4; X++)
+					{
+						const int32 Channel = X & 3;
+						const int32 SrcX = (X - Channel) * 2 + Channel;
+						DstRow[X] = static_cast<uint8>((Row0[SrcX] + Row0[SrcX + 4] + Row1[SrcX] + Row1[SrcX + 4] + 2) >> 2);
+					}
+				}
+				else
+				{
+					// same loop, averaging in linear space through the tables
+					for (int32 X = 0; X < DstWidth * 4; X++)
+					{
+						const int32 Channel = X & 3;
+						const int32 SrcX = (X - Channel) * 2 + Channel;
+						const float* Decode = ToLinear[Channel];
+						const float Linear = Decode[Row0[SrcX]] + Decode[Row0[SrcX + 4]] + Decode[Row1[SrcX]] + Decode[Row1[SrcX + 4]];
+						DstRow[X] = FromLinear[Channel][static_cast<int32>(Linear * ((FColorTables::LinearSteps - 1) * 0.25f) + 0.5f)];
+					}
+				}
+			}
+			return;
+		}
+
+		TArray<FTaps> ColumnTaps;
+		TArray<FTaps> RowTaps;
+		ComputeTaps(SrcWidth, DstWidth, ColumnTaps);
+		ComputeTaps(SrcHeight, DstHeight, RowTaps);
+
+		for (int32 Y = 0; Y < DstHeight; Y++)
+		{
+			const FTaps& RowTap = RowTaps[Y];
+			for (int32 X = 0; X < DstWidth; X++)
+			{
+				const FTaps& ColumnTap = ColumnTaps[X];
+				float Linear[4] = { 0, 0, 0, 0 };
+				for (int32 RowIndex = 0; RowIndex < RowTap.Num; RowIndex++)
+				{
+					const uint8* SrcRow = reinterpret_cast<const uint8*>(Src + static_cast<int64>(RowTap.Index[RowIndex]) * SrcWidth);
+					for (int32 ColumnIndex = 0; ColumnIndex < ColumnTap.Num; ColumnIndex++)
+					{
+						const uint8* Texel = SrcRow + ColumnTap.Index[ColumnIndex] * 4;
+						const float Weight = RowTap.Weight[RowIndex] * ColumnTap.Weight[ColumnIndex];
+						for (int32 Channel = 0; Channel < 4; Channel++)
+						{
+							Linear[Channel] += ToLinear[Channel][Texel[Channel]] * Weight;
+						}
+					}
+				}
+				uint8* DstTexel = reinterpret_cast<uint8*>(Dst + static_cast<int64>(Y) * DstWidth + X);
+				for (int32 Channel = 0; Channel < 4; Channel++)
+				{
+					DstTexel[Channel] = FromLinear[Channel][FMath::Clamp(static_cast<int32>(Linear[Channel] * (FColorTables::LinearSteps - 1) + 0.5f), 0, FColorTables::LinearSteps - 1)];
+				}
+			}
+		}
+	}
+
+	static void VerticalFlip(TArray64<uint8>& UncompressedBytes, const int32 Width, const int32 Height, const EPixelFormat PixelFormat)
+	{
+		if (GPixelFormats[PixelFormat].BlockSizeX != 1 || GPixelFormats[PixelFormat].BlockSizeY != 1)
+		{
+			return;
+		}
+
+		TArray<uint8> Flipped;
+		const int64 Pitch = Width * GPixelFormats[PixelFormat].BlockBytes;
+		Flipped.AddUninitialized(Pitch * Height);
+		for (int32 ImageY = 0; ImageY < Height; ImageY++)
+		{
+			FMemory::Memcpy(Flipped.GetData() + (Pitch * (Height - 1 - ImageY)), UncompressedBytes.GetData() + Pitch * ImageY, Pitch);
+		}
+		UncompressedBytes = Flipped;
+	}
+
+	// resizes (if required) a decoded image and (eventually) generates its mips
+	static void BuildMips(const int32 TextureIndex, TArray64<uint8>&& UncompressedBytes, int32 Width, int32 Height, const EPixelFormat PixelFormat, TArray<FglTFRuntimeMipMap>& Mips, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const int32 MaxMips = 0)
+	{
+		if (Width > 0 && Height > 0 &&
+			(Width % GPixelFormats[PixelFormat].BlockSizeX) == 0 &&
+			(Height % GPixelFormats[PixelFormat].BlockSizeY) == 0)
+		{
+
+			// limit image size (currently only PF_B8G8R8A8 is supported)
+			if (PixelFormat == EPixelFormat::PF_B8G8R8A8 && (MaterialsConfig.ImagesConfig.MaxWidth > 0 || MaterialsConfig.ImagesConfig.MaxHeight > 0) && GPixelFormats[PixelFormat].BlockSizeX == 1 && GPixelFormats[PixelFormat].BlockSizeY == 1)
+			{
+				const int32 NewWidth = MaterialsConfig.ImagesConfig.MaxWidth > 0 ? MaterialsConfig.ImagesConfig.MaxWidth : Width;
+				const int32 NewHeight = MaterialsConfig.ImagesConfig.MaxHeight > 0 ? MaterialsConfig.ImagesConfig.MaxHeight : Height;
+				TArray64<FColor> ResizedPixels;
+				ResizedPixels.AddUninitialized(NewWidth * NewHeight);
+#if ENGINE_MAJOR_VERSION >= 5
+				FImageUtils::ImageResize(Width, Height, TArrayView<FColor>(reinterpret_cast<FColor*>(UncompressedBytes.GetData()), UncompressedBytes.Num()), NewWidth, NewHeight, ResizedPixels, sRGB, false);
+#else
+				FImageUtils::ImageResize(Width, Height, TArrayView<FColor>(reinterpret_cast<FColor*>(UncompressedBytes.GetData()), UncompressedBytes.Num()), NewWidth, NewHeight, ResizedPixels, sRGB);
+#endif
+				Width = NewWidth;
+				Height = NewHeight;
+				UncompressedBytes.Empty(ResizedPixels.Num() * 4);
+				UncompressedBytes.Append(reinterpret_cast<uint8*>(ResizedPixels.GetData()), ResizedPixels.Num() * 4);
+			}
+
+			int32 NumOfMips = 1;
+
+			// every level is generated from the previous one (non power of two sizes are supported too)
+			if (MaterialsConfig.bGeneratesMipMaps && PixelFormat == EPixelFormat::PF_B8G8R8A8)
+			{
+				NumOfMips = FMath::FloorLog2(FMath::Max(Width, Height)) + 1;
+			}
+
+			// streaming only needs the levels of the current request
+			if (MaxMips > 0)
+			{
+				NumOfMips = FMath::Min(NumOfMips, MaxMips);
+			}
+
+			Mips.Reserve(Mips.Num() + NumOfMips);
+
+			int32 MipWidth = Width;
+			int32 MipHeight = Height;
+
+			for (int32 MipIndex = 0; MipIndex < NumOfMips; MipIndex++)
+			{
+				FglTFRuntimeMipMap MipMap(TextureIndex);
+				MipMap.Width = MipWidth;
+				MipMap.Height = MipHeight;
+				MipMap.PixelFormat = PixelFormat;
+
+				if (MipIndex > 0)
+				{
+					const FglTFRuntimeMipMap& PreviousMipMap = Mips.Last();
+					MipMap.Pixels.AddUninitialized(static_cast<int64>(MipWidth) * MipHeight * 4);
+					Downsample(reinterpret_cast<const FColor*>(PreviousMipMap.Pixels.GetData()), PreviousMipMap.Width, PreviousMipMap.Height,
+						reinterpret_cast<FColor*>(MipMap.Pixels.GetData()), MipWidth, MipHeight, sRGB);
+				}
+				else
+				{
+					MipMap.Pixels = MoveTemp(UncompressedBytes);
+				}
+
+				Mips.Add(MoveTemp(MipMap));
+
+				MipWidth = FMath::Max(MipWidth / 2, 1);
+				MipHeight = FMath::Max(MipHeight / 2, 1);
+			}
+		}
+	}
+}
+
 
 UMaterialInterface* FglTFRuntimeParser::LoadMaterial_Internal(const int32 Index, const FString& MaterialName, TSharedRef<FJsonObject> JsonMaterialObject, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bUseVertexColors)
 {
@@ -159,6 +410,11 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial_Internal(const int32 Index,
 			}
 
 			ParamTextureCache = LoadTexture(TextureIndex, ParamMips, sRGB, MaterialsConfig, Sampler);
+			// prefetched mips could be already compressed
+			if (!ParamTextureCache && MaterialsConfig.ImagesConfig.bCompressMips && ParamMips.Num() > 0 && ParamMips[0].PixelFormat == EPixelFormat::PF_B8G8R8A8)
+			{
+				FglTFRuntimeTextureCompressor::CompressMips(ParamMips, bForceNormalMapCompression);
+			}
 			return *JsonTextureObject;
 		}
 		return nullptr;
@@ -320,13 +576,38 @@ UTexture2D* FglTFRuntimeParser::BuildTexture(UObject* Outer, const TArray<FglTFR
 	Texture->LODBias = (ImagesConfig.LODBias >= 0 && ImagesConfig.LODBias < (Mips.Num() - 1)) ? ImagesConfig.LODBias : 0;
 	Texture->NeverStream = !ImagesConfig.bStreaming;
 
+	// the bulk data of the streamed mips is left empty, the mip data provider will decode them from the source
+	int32 NumStreamedMips = 0;
 	if (ImagesConfig.bStreaming)
 	{
-		Texture->AddAssetUserData(NewObject<UglTFRuntimeTextureMipDataProviderFactory>());
+		UglTFRuntimeTextureMipDataProviderFactory* MipDataProviderFactory = NewObject<UglTFRuntimeTextureMipDataProviderFactory>();
+		if (ImagesConfig.bStreamFromSource)
+		{
+			FScopeLock Lock(&TextureStreamingSourcesLock);
+			TextureStreamingSources.RemoveAndCopyValue(TPair<int32, bool>(Mips[0].TextureIndex, ImagesConfig.bSRGB), MipDataProviderFactory->StreamingSource);
+		}
+
+		if (MipDataProviderFactory->StreamingSource)
+		{
+			MipDataProviderFactory->StreamingSource->PixelFormat = Mips[0].PixelFormat;
+#if !WITH_EDITOR
+			// the editor does not stream runtime textures (see the bulk data hack below), so every mip is kept there
+			NumStreamedMips = FMath::Max(Mips.Num() - UTexture2D::GetMinTextureResidentMipCount(), 0);
+#endif
+			MipDataProviderFactory->StreamingSource->NumStreamedMips = NumStreamedMips;
+			// nothing to decode later, release the encoded image
+			if (NumStreamedMips == 0)
+			{
+				MipDataProviderFactory->StreamingSource.Reset();
+			}
+		}
+
+		Texture->AddAssetUserData(MipDataProviderFactory);
 	}
 
-	for (const FglTFRuntimeMipMap& MipMap : Mips)
+	for (int32 MipIndex = 0; MipIndex < Mips.Num(); MipIndex++)
 	{
+		const FglTFRuntimeMipMap& MipMap = Mips[MipIndex];
 		FTexture2DMipMap* Mip = new FTexture2DMipMap();
 		PlatformData->Mips.Add(Mip);
 		Mip->SizeX = MipMap.Width;
@@ -358,8 +639,11 @@ UTexture2D* FglTFRuntimeParser::BuildTexture(UObject* Outer, const TArray<FglTFR
 		}
 #endif
 #endif
-		void* Data = Mip->BulkData.Realloc(MipMap.Pixels.Num());
-		FMemory::Memcpy(Data, MipMap.Pixels.GetData(), MipMap.Pixels.Num());
+		if (MipIndex >= NumStreamedMips)
+		{
+			void* Data = Mip->BulkData.Realloc(MipMap.Pixels.Num());
+			FMemory::Memcpy(Data, MipMap.Pixels.GetData(), MipMap.Pixels.Num());
+		}
 		Mip->BulkData.Unlock();
 	}
 
@@ -383,7 +667,10 @@ UTexture2D* FglTFRuntimeParser::BuildTexture(UObject* Outer, const TArray<FglTFR
 
 	Texture->UpdateResource();
 
-	TexturesCache.Add(Mips[0].TextureIndex, Texture);
+	{
+		FWriteScopeLock Lock(TexturesCacheLock);
+		TexturesCache.Add(Mips[0].TextureIndex, Texture);
+	}
 
 	return Texture;
 }
@@ -629,101 +916,105 @@ UMaterialInterface* FglTFRuntimeParser::BuildMaterial(const int32 Index, const F
 	return Material;
 }
 
-bool FglTFRuntimeParser::LoadImageFromBlob(const TArray64<uint8>& Blob, TSharedRef<FJsonObject> JsonImageObject, TArray64<uint8>& UncompressedBytes, int32& Width, int32& Height, EPixelFormat& PixelFormat, const FglTFRuntimeImagesConfig& ImagesConfig)
+bool FglTFRuntimeParser::DecodeImage(const TArray64<uint8>& Blob, TArray64<uint8>& UncompressedBytes, int32& Width, int32& Height, EPixelFormat& PixelFormat, const FglTFRuntimeImagesConfig& ImagesConfig, FString& Error)
 {
-	OnTexturePixels.Broadcast(AsShared(), JsonImageObject, Blob, Width, Height, PixelFormat, UncompressedBytes, ImagesConfig);
+	PixelFormat = EPixelFormat::PF_B8G8R8A8;
 
-	if (UncompressedBytes.Num() == 0)
+	// check for DDS first
+	if (FglTFRuntimeDDS::IsDDS(Blob))
 	{
-
-		PixelFormat = EPixelFormat::PF_B8G8R8A8;
-
-		// check for DDS first
-		if (FglTFRuntimeDDS::IsDDS(Blob))
+		FglTFRuntimeDDS DDS(Blob);
+		TArray<FglTFRuntimeMipMap> DDSMips;
+		DDS.LoadMips(-1, DDSMips, 1, ImagesConfig);
+		if (DDSMips.Num() > 0)
 		{
-			FglTFRuntimeDDS DDS(Blob);
-			TArray<FglTFRuntimeMipMap> DDSMips;
-			DDS.LoadMips(-1, DDSMips, 1, ImagesConfig);
-			if (DDSMips.Num() > 0)
-			{
-				UncompressedBytes = DDSMips[0].Pixels;
-				PixelFormat = DDSMips[0].PixelFormat;
-				Width = DDSMips[0].Width;
-				Height = DDSMips[0].Height;
-			}
+			UncompressedBytes = DDSMips[0].Pixels;
+			PixelFormat = DDSMips[0].PixelFormat;
+			Width = DDSMips[0].Width;
+			Height = DDSMips[0].Height;
 		}
+	}
 
-		if (UncompressedBytes.Num() == 0)
-		{
-			IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+	if (UncompressedBytes.Num() == 0)
+	{
+		IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
 
-			EImageFormat ImageFormat = ImageWrapperModule.DetectImageFormat(Blob.GetData(), Blob.Num());
-			if (ImageFormat == EImageFormat::Invalid)
-			{
-				AddError("LoadImageFromBlob()", "Unable to detect image format");
-				return false;
-			}
+		EImageFormat ImageFormat = ImageWrapperModule.DetectImageFormat(Blob.GetData(), Blob.Num());
+		if (ImageFormat == EImageFormat::Invalid)
+		{
+			Error = "Unable to detect image format";
+			return false;
+		}
 
-			ERGBFormat RGBFormat = ERGBFormat::BGRA;
-			int32 BitDepth = 8;
+		ERGBFormat RGBFormat = ERGBFormat::BGRA;
+		int32 BitDepth = 8;
 
 #if ENGINE_MAJOR_VERSION >= 5
-			if (ImageFormat == EImageFormat::EXR)
-			{
-				RGBFormat = ERGBFormat::RGBAF;
-				BitDepth = 16;
-				PixelFormat = EPixelFormat::PF_FloatRGBA;
-			}
+		if (ImageFormat == EImageFormat::EXR)
+		{
+			RGBFormat = ERGBFormat::RGBAF;
+			BitDepth = 16;
+			PixelFormat = EPixelFormat::PF_FloatRGBA;
+		}
 #endif
 
-			TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(ImageFormat);
-			if (!ImageWrapper.IsValid())
-			{
-				AddError("LoadImageFromBlob()", "Unable to create ImageWrapper");
-				return false;
-			}
-			if (!ImageWrapper->SetCompressed(Blob.GetData(), Blob.Num()))
-			{
-				AddError("LoadImageFromBlob()", "Unable to parse image data");
-				return false;
-			}
+		TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(ImageFormat);
+		if (!ImageWrapper.IsValid())
+		{
+			Error = "Unable to create ImageWrapper";
+			return false;
+		}
+		if (!ImageWrapper->SetCompressed(Blob.GetData(), Blob.Num()))
+		{
+			Error = "Unable to parse image data";
+			return false;
+		}
 
 #if ENGINE_MAJOR_VERSION >= 5
-			if (!ImageWrapper->GetRaw(ImagesConfig.bForceHDR ? ERGBFormat::RGBAF : RGBFormat, ImagesConfig.bForceHDR ? 16 : BitDepth, UncompressedBytes))
+		if (!ImageWrapper->GetRaw(ImagesConfig.bForceHDR ? ERGBFormat::RGBAF : RGBFormat, ImagesConfig.bForceHDR ? 16 : BitDepth, UncompressedBytes))
 #else
-			if (!ImageWrapper->GetRaw(RGBFormat, ImagesConfig.bForceHDR ? 16 : BitDepth, UncompressedBytes))
+		if (!ImageWrapper->GetRaw(RGBFormat, ImagesConfig.bForceHDR ? 16 : BitDepth, UncompressedBytes))
 #endif
-			{
-				AddError("LoadImageFromBlob()", "Unable to get raw image data");
-				return false;
-			}
-
-			if (ImagesConfig.bForceHDR)
-			{
-				PixelFormat = EPixelFormat::PF_FloatRGBA;
-			}
+		{
+			Error = "Unable to get raw image data";
+			return false;
+		}
 
-			Width = ImageWrapper->GetWidth();
-			Height = ImageWrapper->GetHeight();
+		if (ImagesConfig.bForceHDR)
+		{
+			PixelFormat = EPixelFormat::PF_FloatRGBA;
 		}
+
+		Width = ImageWrapper->GetWidth();
+		Height = ImageWrapper->GetHeight();
 	}
 
-	if (ImagesConfig.bVerticalFlip && GPixelFormats[PixelFormat].BlockSizeX == 1 && GPixelFormats[PixelFormat].BlockSizeY == 1)
+	return true;
+}
+
+bool FglTFRuntimeParser::LoadImageFromBlob(const TArray64<uint8>& Blob, TSharedRef<FJsonObject> JsonImageObject, TArray64<uint8>& UncompressedBytes, int32& Width, int32& Height, EPixelFormat& PixelFormat, const FglTFRuntimeImagesConfig& ImagesConfig)
+{
+	OnTexturePixels.Broadcast(AsShared(), JsonImageObject, Blob, Width, Height, PixelFormat, UncompressedBytes, ImagesConfig);
+
+	if (UncompressedBytes.Num() == 0)
 	{
-		TArray<uint8> Flipped;
-		const int64 Pitch = Width * GPixelFormats[PixelFormat].BlockBytes;
-		Flipped.AddUninitialized(Pitch * Height);
-		for (int32 ImageY = 0; ImageY < Height; ImageY++)
+		FString Error;
+		if (!DecodeImage(Blob, UncompressedBytes, Width, Height, PixelFormat, ImagesConfig, Error))
 		{
-			FMemory::Memcpy(Flipped.GetData() + (Pitch * (Height - 1 - ImageY)), UncompressedBytes.GetData() + Pitch * ImageY, Pitch);
+			AddError("LoadImageFromBlob()", Error);
+			return false;
 		}
-		UncompressedBytes = Flipped;
+	}
+
+	if (ImagesConfig.bVerticalFlip)
+	{
+		glTFRuntimeMips::VerticalFlip(UncompressedBytes, Width, Height, PixelFormat);
 	}
 
 	return true;
 }
 
-bool FglTFRuntimeParser::LoadImageBytes(const int32 ImageIndex, TSharedPtr<FJsonObject>& JsonImageObject, TArray64<uint8>& Bytes)
+bool FglTFRuntimeParser::LoadImageBytes(const int32 ImageIndex, TSharedPtr<FJsonObject>& JsonImageObject, TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe>& Bytes)
 {
 
 	JsonImageObject = GetJsonObjectFromRootIndex("images", ImageIndex);
@@ -746,13 +1037,13 @@ bool FglTFRuntimeParser::LoadImageBytes(const int32 ImageIndex, TSharedPtr<FJson
 bool FglTFRuntimeParser::LoadImage(const int32 ImageIndex, TArray64<uint8>& UncompressedBytes, int32& Width, int32& Height, EPixelFormat& PixelFormat, const FglTFRuntimeImagesConfig& ImagesConfig)
 {
 	TSharedPtr<FJsonObject> JsonImageObject;
-	TArray64<uint8> Bytes;
+	TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> Bytes;
 	if (!LoadImageBytes(ImageIndex, JsonImageObject, Bytes))
 	{
 		return false;
 	}
 
-	return LoadImageFromBlob(Bytes, JsonImageObject.ToSharedRef(), UncompressedBytes, Width, Height, PixelFormat, ImagesConfig);
+	return LoadImageFromBlob(*Bytes, JsonImageObject.ToSharedRef(), UncompressedBytes, Width, Height, PixelFormat, ImagesConfig);
 }
 
 UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<FglTFRuntimeMipMap>& Mips, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig, FglTFRuntimeTextureSampler& Sampler)
@@ -770,9 +1061,12 @@ UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<Fgl
 	}
 
 	// first check cache
-	if (TexturesCache.Contains(TextureIndex))
 	{
-		return TexturesCache[TextureIndex];
+		FReadScopeLock Lock(TexturesCacheLock);
+		if (UTexture2D** CachedTexture = TexturesCache.Find(TextureIndex))
+		{
+			return *CachedTexture;
+		}
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* JsonTextures;
@@ -806,16 +1100,37 @@ UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<Fgl
 		return MaterialsConfig.ImagesOverrideMap[ImageIndex];
 	}
 
-	TSharedPtr<FJsonObject> JsonImageObject;
-	TArray64<uint8> CompressedBytes;
-	if (!LoadImageBytes(ImageIndex, JsonImageObject, CompressedBytes))
+	// the image could have been already decoded by PrefetchTextures (keyed like the streaming sources)
+	bool bPrefetched = false;
 	{
-		return nullptr;
+		FScopeLock Lock(&PrefetchedMipsCacheLock);
+		const TPair<int32, bool> PrefetchKey(TextureIndex, sRGB);
+		if (TArray<FglTFRuntimeMipMap>* PrefetchedMips = PrefetchedMipsCache.Find(PrefetchKey))
+		{
+			Mips = MoveTemp(*PrefetchedMips);
+			PrefetchedMipsCache.Remove(PrefetchKey);
+			bPrefetched = true;
+		}
 	}
 
-	if (!LoadBlobToMips(TextureIndex, JsonTextureObject.ToSharedRef(), JsonImageObject.ToSharedRef(), CompressedBytes, Mips, sRGB, MaterialsConfig))
+	if (!bPrefetched)
 	{
-		return nullptr;
+		TSharedPtr<FJsonObject> JsonImageObject;
+		TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> CompressedBytes;
+		if (!LoadImageBytes(ImageIndex, JsonImageObject, CompressedBytes))
+		{
+			return nullptr;
+		}
+
+		if (!LoadBlobToMips(TextureIndex, JsonTextureObject.ToSharedRef(), JsonImageObject.ToSharedRef(), *CompressedBytes, Mips, sRGB, MaterialsConfig))
+		{
+			return nullptr;
+		}
+
+		if (MaterialsConfig.ImagesConfig.bStreaming && MaterialsConfig.ImagesConfig.bStreamFromSource)
+		{
+			AddTextureStreamingSource(TextureIndex, CompressedBytes, sRGB, MaterialsConfig);
+		}
 	}
 
 	int64 SamplerIndex;
@@ -886,118 +1201,222 @@ UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<Fgl
 	return nullptr;
 }
 
-bool FglTFRuntimeParser::LoadBlobToMips(const int32 TextureIndex, TSharedRef<FJsonObject> JsonTextureObject, TSharedRef<FJsonObject> JsonImageObject, const TArray64<uint8>& Blob, TArray<FglTFRuntimeMipMap>& Mips, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+void FglTFRuntimeParser::PrefetchTextures(const FglTFRuntimeMaterialsConfig& MaterialsConfig)
 {
-	if (MaterialsConfig.bLoadMipMaps)
+	// only the first material triggers the prefetch
+	if (bTexturesPrefetched.AtomicSet(true))
 	{
-		OnTextureMips.Broadcast(AsShared(), TextureIndex, JsonTextureObject, JsonImageObject, Blob, Mips, MaterialsConfig.ImagesConfig);
-		// if no Mips have been loaded, attempt parsing a DDS asset
-		if (Mips.Num() == 0)
-		{
-			if (FglTFRuntimeDDS::IsDDS(Blob))
-			{
-				FglTFRuntimeDDS DDS(Blob);
-				DDS.LoadMips(TextureIndex, Mips, 0, MaterialsConfig.ImagesConfig);
-			}
-		}
+		return;
 	}
 
-	// if no Mips have been generated, load it as a plain image and (eventually) generate them
-	if (Mips.Num() == 0)
-	{
-		TArray64<uint8> UncompressedBytes;
-		int32 Width = 0;
-		int32 Height = 0;
-		EPixelFormat PixelFormat;
-		if (!LoadImageFromBlob(Blob, JsonImageObject, UncompressedBytes, Width, Height, PixelFormat, MaterialsConfig.ImagesConfig))
-		{
-			return false;
-		}
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_PrefetchTextures, FColor::Magenta);
 
-		OnLoadedTexturePixels.Broadcast(AsShared(), JsonTextureObject, Width, Height, reinterpret_cast<FColor*>(UncompressedBytes.GetData()));
+	const TArray<TSharedPtr<FJsonValue>>* JsonMaterials;
+	if (!Root->TryGetArrayField("materials", JsonMaterials))
+	{
+		return;
+	}
 
-		if (Width > 0 && Height > 0 &&
-			(Width % GPixelFormats[PixelFormat].BlockSizeX) == 0 &&
-			(Height % GPixelFormats[PixelFormat].BlockSizeY) == 0)
+	// snapshot of the already built textures, BuildTexture can add more while scanning
+	TSet<int32> CachedTextures;
+	{
+		FReadScopeLock Lock(TexturesCacheLock);
+		TexturesCache.GetKeys(CachedTextures);
+	}
+
+	// same slots (and color spaces) used by LoadMaterial_Internal
+	TArray<TPair<int32, bool>> TexturesToDecode;
+	// textures used both as normal maps and as something else are compressed later by LoadMaterial_Internal
+	TSet<TPair<int32, bool>> NormalMapTextures;
+	TSet<TPair<int32, bool>> ColorTextures;
+	auto AddTexture = [&](const TSharedPtr<FJsonObject>& JsonObject, const FString& ParamName, const bool sRGB, const bool bNormalMap = false)
+	{
+		const TSharedPtr<FJsonObject>* JsonTextureObject;
+		int64 TextureIndex;
+		if (!JsonObject || !JsonObject->TryGetObjectField(ParamName, JsonTextureObject) || !(*JsonTextureObject)->TryGetNumberField("index", TextureIndex))
 		{
+			return;
+		}
 
-			// limit image size (currently only PF_B8G8R8A8 is supported)
-			if (PixelFormat == EPixelFormat::PF_B8G8R8A8 && (MaterialsConfig.ImagesConfig.MaxWidth > 0 || MaterialsConfig.ImagesConfig.MaxHeight > 0) && GPixelFormats[PixelFormat].BlockSizeX == 1 && GPixelFormats[PixelFormat].BlockSizeY == 1)
+		if (TextureIndex < 0 || MaterialsConfig.TexturesOverrideMap.Contains(TextureIndex) || CachedTextures.Contains(TextureIndex))
+		{
+			return;
+		}
+
+		const TPair<int32, bool> TextureKey(TextureIndex, sRGB);
+		TexturesToDecode.AddUnique(TextureKey);
+		if (bNormalMap)
+		{
+			NormalMapTextures.Add(TextureKey);
+		}
+		else
+		{
+			ColorTextures.Add(TextureKey);
+		}
+	};
+
+	auto GetObjectField = [](const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName) -> TSharedPtr<FJsonObject>
+	{
+		const TSharedPtr<FJsonObject>* JsonFieldObject;
+		if (JsonObject && JsonObject->TryGetObjectField(FieldName, JsonFieldObject))
+		{
+			return *JsonFieldObject;
+		}
+		return nullptr;
+	};
+
+	TSet<int32> PendingMaterials;
+	for (int32 MaterialIndex = 0; MaterialIndex < JsonMaterials->Num(); MaterialIndex++)
+	{
+		const TSharedPtr<FJsonObject> JsonMaterialObject = (*JsonMaterials)[MaterialIndex]->AsObject();
+		if (!JsonMaterialObject)
+		{
+			continue;
+		}
+
+		// overridden materials never reach LoadMaterial_Internal
+		FString MaterialName;
+		JsonMaterialObject->TryGetStringField("name", MaterialName);
+		if (!MaterialsConfig.bMaterialsOverrideMapInjectParams && (MaterialsConfig.MaterialsOverrideMap.Contains(MaterialIndex) || MaterialsConfig.MaterialsOverrideByNameMap.Contains(MaterialName)))
+		{
+			continue;
+		}
+
+		{
+			FReadScopeLock Lock(MaterialsCacheLock);
+			if (MaterialsCache.Contains(MaterialIndex))
 			{
-				const int32 NewWidth = MaterialsConfig.ImagesConfig.MaxWidth > 0 ? MaterialsConfig.ImagesConfig.MaxWidth : Width;
-				const int32 NewHeight = MaterialsConfig.ImagesConfig.MaxHeight > 0 ? MaterialsConfig.ImagesConfig.MaxHeight : Height;
-				TArray64<FColor> ResizedPixels;
-				ResizedPixels.AddUninitialized(NewWidth * NewHeight);
-#if ENGINE_MAJOR_VERSION >= 5
-				FImageUtils::ImageResize(Width, Height, TArrayView<FColor>(reinterpret_cast<FColor*>(UncompressedBytes.GetData()), UncompressedBytes.Num()), NewWidth, NewHeight, ResizedPixels, sRGB, false);
-#else
-				FImageUtils::ImageResize(Width, Height, TArrayView<FColor>(reinterpret_cast<FColor*>(UncompressedBytes.GetData()), UncompressedBytes.Num()), NewWidth, NewHeight, ResizedPixels, sRGB);
-#endif
-				Width = NewWidth;
-				Height = NewHeight;
-				UncompressedBytes.Empty(ResizedPixels.Num() * 4);
-				UncompressedBytes.Append(reinterpret_cast<uint8*>(ResizedPixels.GetData()), ResizedPixels.Num() * 4);
+				continue;
 			}
+		}
 
-			int32 NumOfMips = 1;
+		PendingMaterials.Add(MaterialIndex);
+
+		const TSharedPtr<FJsonObject> JsonPBRObject = GetObjectField(JsonMaterialObject, "pbrMetallicRoughness");
+		AddTexture(JsonPBRObject, "baseColorTexture", true);
+		AddTexture(JsonPBRObject, "metallicRoughnessTexture", false);
+		AddTexture(JsonMaterialObject, "normalTexture", false, true);
+		AddTexture(JsonMaterialObject, "occlusionTexture", false);
+		AddTexture(JsonMaterialObject, "emissiveTexture", true);
+
+		const TSharedPtr<FJsonObject> JsonExtensions = GetObjectField(JsonMaterialObject, "extensions");
+		const TSharedPtr<FJsonObject> JsonPbrSpecularGlossiness = GetObjectField(JsonExtensions, "KHR_materials_pbrSpecularGlossiness");
+		AddTexture(JsonPbrSpecularGlossiness, "diffuseTexture", true);
+		AddTexture(JsonPbrSpecularGlossiness, "specularGlossinessTexture", true);
+		AddTexture(GetObjectField(JsonExtensions, "KHR_materials_transmission"), "transmissionTexture", false);
+		AddTexture(GetObjectField(JsonExtensions, "KHR_materials_specular"), "specularTexture", false);
+	}
+
+	{
+		FScopeLock Lock(&PrefetchedMipsCacheLock);
+		PrefetchPendingMaterials = MoveTemp(PendingMaterials);
+	}
 
-			TArray64<FColor> UncompressedColors;
+	// delegates are always triggered on the calling thread
+	TArray<TSharedRef<FJsonObject>> JsonTextureObjects;
+	TArray<int64> ImageIndices;
+	for (int32 Index = 0; Index < TexturesToDecode.Num(); Index++)
+	{
+		TSharedPtr<FJsonObject> JsonTextureObject = GetJsonObjectFromRootIndex("textures", TexturesToDecode[Index].Key);
+		if (!JsonTextureObject)
+		{
+			TexturesToDecode.RemoveAt(Index--);
+			continue;
+		}
 
-			if (MaterialsConfig.bGeneratesMipMaps && GPixelFormats[PixelFormat].BlockSizeX == 1 && GPixelFormats[PixelFormat].BlockSizeY == 1 && FMath::IsPowerOfTwo(Width) && FMath::IsPowerOfTwo(Height))
+		int64 ImageIndex = INDEX_NONE;
+		OnTextureImageIndex.Broadcast(AsShared(), JsonTextureObject.ToSharedRef(), ImageIndex);
+
+		if ((ImageIndex <= INDEX_NONE && !JsonTextureObject->TryGetNumberField("source", ImageIndex)) || MaterialsConfig.ImagesOverrideMap.Contains(ImageIndex))
+		{
+			TexturesToDecode.RemoveAt(Index--);
+			continue;
+		}
+
+		JsonTextureObjects.Add(JsonTextureObject.ToSharedRef());
+		ImageIndices.Add(ImageIndex);
+	}
+
+	// the decoding hooks are broadcast by LoadImageFromBlob and LoadBlobToMips, when one of them is bound
+	// the images are decoded on the calling thread too
+	const bool bDecodeOnCallingThread = OnTextureMips.IsBound() || OnTexturePixels.IsBound() || OnLoadedTexturePixels.IsBound() || OnTextureFilterMips.IsBound();
+
+	ParallelFor(TexturesToDecode.Num(), [&](const int32 Index)
+		{
+			const int32 TextureIndex = TexturesToDecode[Index].Key;
+			const bool sRGB = TexturesToDecode[Index].Value;
+			const TSharedRef<FJsonObject> JsonTextureObject = JsonTextureObjects[Index];
+
+			// failures are not cached, LoadTexture will report them again
+			TSharedPtr<FJsonObject> JsonImageObject;
+			TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> CompressedBytes;
+			if (!LoadImageBytes(ImageIndices[Index], JsonImageObject, CompressedBytes))
 			{
-				NumOfMips = FMath::FloorLog2(FMath::Max(Width, Height)) + 1;
+				return;
+			}
 
-				for (int32 MipY = 0; MipY < Height; MipY++)
-				{
-					for (int32 MipX = 0; MipX < Width; MipX++)
-					{
-						int64 MipColorIndex = ((MipY * Width) + MipX) * 4;
-						uint8 MipColorB = UncompressedBytes[MipColorIndex];
-						uint8 MipColorG = UncompressedBytes[MipColorIndex + 1];
-						uint8 MipColorR = UncompressedBytes[MipColorIndex + 2];
-						uint8 MipColorA = UncompressedBytes[MipColorIndex + 3];
-						UncompressedColors.Add(FColor(MipColorR, MipColorG, MipColorB, MipColorA));
-					}
-				}
+			TArray<FglTFRuntimeMipMap> Mips;
+			if (!LoadBlobToMips(TextureIndex, JsonTextureObject, JsonImageObject.ToSharedRef(), *CompressedBytes, Mips, sRGB, MaterialsConfig))
+			{
+				return;
 			}
 
-			int32 MipWidth = Width;
-			int32 MipHeight = Height;
+			if (MaterialsConfig.ImagesConfig.bStreaming && MaterialsConfig.ImagesConfig.bStreamFromSource)
+			{
+				AddTextureStreamingSource(TextureIndex, CompressedBytes, sRGB, MaterialsConfig);
+			}
 
-			for (int32 MipIndex = 0; MipIndex < NumOfMips; MipIndex++)
+			const bool bNormalMap = NormalMapTextures.Contains(TexturesToDecode[Index]);
+			if (MaterialsConfig.ImagesConfig.bCompressMips && bNormalMap != ColorTextures.Contains(TexturesToDecode[Index]))
 			{
-				FglTFRuntimeMipMap MipMap(TextureIndex);
-				MipMap.Width = MipWidth;
-				MipMap.Height = MipHeight;
-				MipMap.PixelFormat = PixelFormat;
+				FglTFRuntimeTextureCompressor::CompressMips(Mips, bNormalMap);
+			}
 
-				// Resize Image
-				if (MipIndex > 0)
-				{
-					TArray64<FColor> ResizedMipData;
-					ResizedMipData.AddUninitialized(MipWidth * MipHeight);
-					FImageUtils::ImageResize(Width, Height, UncompressedColors, MipWidth, MipHeight, ResizedMipData, sRGB);
-					for (FColor& Color : ResizedMipData)
-					{
-						MipMap.Pixels.Add(Color.B);
-						MipMap.Pixels.Add(Color.G);
-						MipMap.Pixels.Add(Color.R);
-						MipMap.Pixels.Add(Color.A);
-					}
-				}
-				else
-				{
-					MipMap.Pixels = UncompressedBytes;
-				}
+			FScopeLock Lock(&PrefetchedMipsCacheLock);
+			PrefetchedMipsCache.Add(TexturesToDecode[Index], MoveTemp(Mips));
+		}, bDecodeOnCallingThread);
+}
 
-				Mips.Add(MipMap);
+void FglTFRuntimeParser::ReleasePrefetchedTextures()
+{
+	FScopeLock Lock(&PrefetchedMipsCacheLock);
+	PrefetchedMipsCache.Empty();
+	PrefetchPendingMaterials.Empty();
+}
 
-				MipWidth = FMath::Max(MipWidth / 2, 1);
-				MipHeight = FMath::Max(MipHeight / 2, 1);
+bool FglTFRuntimeParser::LoadBlobToMips(const int32 TextureIndex, TSharedRef<FJsonObject> JsonTextureObject, TSharedRef<FJsonObject> JsonImageObject, const TArray64<uint8>& Blob, TArray<FglTFRuntimeMipMap>& Mips, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+{
+	if (MaterialsConfig.bLoadMipMaps)
+	{
+		OnTextureMips.Broadcast(AsShared(), TextureIndex, JsonTextureObject, JsonImageObject, Blob, Mips, MaterialsConfig.ImagesConfig);
+		// if no Mips have been loaded, attempt parsing a DDS asset
+		if (Mips.Num() == 0)
+		{
+			if (FglTFRuntimeDDS::IsDDS(Blob))
+			{
+				FglTFRuntimeDDS DDS(Blob);
+				DDS.LoadMips(TextureIndex, Mips, 0, MaterialsConfig.ImagesConfig);
 			}
 		}
 	}
 
+	// if no Mips have been generated, load it as a plain image and (eventually) generate them
+	if (Mips.Num() == 0)
+	{
+		TArray64<uint8> UncompressedBytes;
+		int32 Width = 0;
+		int32 Height = 0;
+		EPixelFormat PixelFormat;
+		if (!LoadImageFromBlob(Blob, JsonImageObject, UncompressedBytes, Width, Height, PixelFormat, MaterialsConfig.ImagesConfig))
+		{
+			return false;
+		}
+
+		OnLoadedTexturePixels.Broadcast(AsShared(), JsonTextureObject, Width, Height, reinterpret_cast<FColor*>(UncompressedBytes.GetData()));
+
+		glTFRuntimeMips::BuildMips(TextureIndex, MoveTemp(UncompressedBytes), Width, Height, PixelFormat, Mips, sRGB, MaterialsConfig);
+	}
+
 	OnTextureFilterMips.Broadcast(AsShared(), Mips, MaterialsConfig.ImagesConfig);
 
 	return true;
@@ -1015,14 +1434,18 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial(const int32 Index, const Fg
 		return MaterialsConfig.MaterialsOverrideMap[Index];
 	}
 
-	// first check cache
-	if (CanReadFromCache(MaterialsConfig.CacheMode) && MaterialsCache.Contains(Index))
+	// first check cache (meshes can be loaded concurrently by async loaders)
+	if (CanReadFromCache(MaterialsConfig.CacheMode))
 	{
-		if (MaterialsNameCache.Contains(MaterialsCache[Index]))
+		FReadScopeLock Lock(MaterialsCacheLock);
+		if (UMaterialInterface** CachedMaterial = MaterialsCache.Find(Index))
 		{
-			MaterialName = MaterialsNameCache[MaterialsCache[Index]];
+			if (MaterialsNameCache.Contains(*CachedMaterial))
+			{
+				MaterialName = MaterialsNameCache[*CachedMaterial];
+			}
+			return *CachedMaterial;
 		}
-		return MaterialsCache[Index];
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* JsonMaterials;
@@ -1055,7 +1478,23 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial(const int32 Index, const Fg
 		return MaterialsConfig.MaterialsOverrideByNameMap[MaterialName];
 	}
 
+	if (MaterialsConfig.bPrefetchTextures)
+	{
+		PrefetchTextures(MaterialsConfig);
+	}
+
 	UMaterialInterface* Material = LoadMaterial_Internal(Index, MaterialName, JsonMaterialObject.ToSharedRef(), MaterialsConfig, bUseVertexColors);
+
+	if (MaterialsConfig.bPrefetchTextures)
+	{
+		// once every prefetched material has been built, the leftover mips are no longer required
+		FScopeLock Lock(&PrefetchedMipsCacheLock);
+		if (PrefetchPendingMaterials.Remove(Index) > 0 && PrefetchPendingMaterials.Num() == 0)
+		{
+			PrefetchedMipsCache.Empty();
+		}
+	}
+
 	if (!Material)
 	{
 		AddError("LoadMaterial()", "Unable to load material");
@@ -1064,6 +1503,7 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial(const int32 Index, const Fg
 
 	if (CanWriteToCache(MaterialsConfig.CacheMode))
 	{
+		FWriteScopeLock Lock(MaterialsCacheLock);
 		MaterialsNameCache.Add(Material, MaterialName);
 		MaterialsCache.Add(Index, Material);
 	}
@@ -1430,11 +1870,395 @@ void FglTFRuntimeDDS::LoadMips(const int32 TextureIndex, TArray<FglTFRuntimeMipM
 	}
 }
 
+namespace glTFRuntimeBCn
+{
+	static uint16 To565(const FVector& Color)
+	{
+		const uint16 R = static_cast<uint16>(FMath::Clamp<int32>(FMath::RoundToInt(Color.X * 31.0 / 255.0), 0, 31));
+		const uint16 G = static_cast<uint16>(FMath::Clamp<int32>(FMath::RoundToInt(Color.Y * 63.0 / 255.0), 0, 63));
+		const uint16 B = static_cast<uint16>(FMath::Clamp<int32>(FMath::RoundToInt(Color.Z * 31.0 / 255.0), 0, 31));
+		return (R << 11) | (G << 5) | B;
+	}
+
+	static FVector From565(const uint16 Color)
+	{
+		const int32 R = (Color >> 11) & 0x1F;
+		const int32 G = (Color >> 5) & 0x3F;
+		const int32 B = Color & 0x1F;
+		return FVector((R << 3) | (R >> 2), (G << 2) | (G >> 4), (B << 3) | (B >> 2));
+	}
+
+	// BC1 block: endpoints on the principal axis of the texels, 4 colors mode only
+	static void EncodeColorBlock(const FColor* Texels, uint8* Block)
+	{
+		FVector Colors[16];
+		FVector Mean = FVector::ZeroVector;
+		for (int32 Index = 0; Index < 16; Index++)
+		{
+			Colors[Index] = FVector(Texels[Index].R, Texels[Index].G, Texels[Index].B);
+			Mean += Colors[Index];
+		}
+		Mean /= 16.0f;
+
+		double Covariance[6] = { 0, 0, 0, 0, 0, 0 };
+		for (int32 Index = 0; Index < 16; Index++)
+		{
+			const FVector Delta = Colors[Index] - Mean;
+			Covariance[0] += Delta.X * Delta.X;
+			Covariance[1] += Delta.X * Delta.Y;
+			Covariance[2] += Delta.X * Delta.Z;
+			Covariance[3] += Delta.Y * Delta.Y;
+			Covariance[4] += Delta.Y * Delta.Z;
+			Covariance[5] += Delta.Z * Delta.Z;
+		}
+
+		// a few power iterations are enough for a 4x4 block
+		FVector Axis(1, 1, 1);
+		for (int32 Iteration = 0; Iteration < 4; Iteration++)
+		{
+			const FVector NewAxis(
+				Covariance[0] * Axis.X + Covariance[1] * Axis.Y + Covariance[2] * Axis.Z,
+				Covariance[1] * Axis.X + Covariance[3] * Axis.Y + Covariance[4] * Axis.Z,
+				Covariance[2] * Axis.X + Covariance[4] * Axis.Y + Covariance[5] * Axis.Z);
+			const double Length = NewAxis.Size();
+			if (Length < KINDA_SMALL_NUMBER)
+			{
+				break;
+			}
+			Axis = NewAxis / Length;
+		}
+
+		double MinProjection = TNumericLimits<double>::Max();
+		double MaxProjection = TNumericLimits<double>::Lowest();
+		for (int32 Index = 0; Index < 16; Index++)
+		{
+			const double Projection = FVector::DotProduct(Colors[Index] - Mean, Axis);
+			MinProjection = FMath::Min(MinProjection, Projection);
+			MaxProjection = FMath::Max(MaxProjection, Projection);
+		}
+
+		// inset the endpoints to reduce the quantization error at the extremes
+		const double Inset = (MaxProjection - MinProjection) / 16.0f;
+		uint16 Color0 = To565(Mean + Axis * (MaxProjection - Inset));
+		uint16 Color1 = To565(Mean + Axis * (MinProjection + Inset));
+		if (Color0 < Color1)
+		{
+			Swap(Color0, Color1);
+		}
+
+		uint32 Indices = 0;
+		if (Color0 != Color1)
+		{
+			FVector Palette[4];
+			Palette[0] = From565(Color0);
+			Palette[1] = From565(Color1);
+			Palette[2] = (Palette[0] * 2 + Palette[1]) / 3.0f;
+			Palette[3] = (Palette[0] + Palette[1] * 2) / 3.0f;
+
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				uint32 BestIndex = 0;
+				double BestDistance = TNumericLimits<double>::Max();
+				for (uint32 PaletteIndex = 0; PaletteIndex < 4; PaletteIndex++)
+				{
+					const double Distance = FVector::DistSquared(Colors[Index], Palette[PaletteIndex]);
+					if (Distance < BestDistance)
+					{
+						BestDistance = Distance;
+						BestIndex = PaletteIndex;
+					}
+				}
+				Indices |= BestIndex << (Index * 2);
+			}
+		}
+
+		Block[0] = Color0 & 0xFF;
+		Block[1] = Color0 >> 8;
+		Block[2] = Color1 & 0xFF;
+		Block[3] = Color1 >> 8;
+		Block[4] = Indices & 0xFF;
+		Block[5] = (Indices >> 8) & 0xFF;
+		Block[6] = (Indices >> 16) & 0xFF;
+		Block[7] = Indices >> 24;
+	}
+
+	// BC4 block (used for the BC3 alpha and the two BC5 channels), 8 values mode only
+	static void EncodeValueBlock(const uint8* Values, uint8* Block)
+	{
+		uint8 MinValue = 255;
+		uint8 MaxValue = 0;
+		for (int32 Index = 0; Index < 16; Index++)
+		{
+			MinValue = FMath::Min(MinValue, Values[Index]);
+			MaxValue = FMath::Max(MaxValue, Values[Index]);
+		}
+
+		uint64 Indices = 0;
+		if (MaxValue != MinValue)
+		{
+			int32 Palette[8];
+			Palette[0] = MaxValue;
+			Palette[1] = MinValue;
+			for (int32 PaletteIndex = 2; PaletteIndex < 8; PaletteIndex++)
+			{
+				Palette[PaletteIndex] = ((8 - PaletteIndex) * MaxValue + (PaletteIndex - 1) * MinValue) / 7;
+			}
+
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				uint64 BestIndex = 0;
+				int32 BestDistance = MAX_int32;
+				for (uint64 PaletteIndex = 0; PaletteIndex < 8; PaletteIndex++)
+				{
+					const int32 Distance = FMath::Abs(Values[Index] - Palette[PaletteIndex]);
+					if (Distance < BestDistance)
+					{
+						BestDistance = Distance;
+						BestIndex = PaletteIndex;
+					}
+				}
+				Indices |= BestIndex << (Index * 3);
+			}
+		}
+
+		Block[0] = MaxValue;
+		Block[1] = MinValue;
+		for (int32 Byte = 0; Byte < 6; Byte++)
+		{
+			Block[2 + Byte] = (Indices >> (Byte * 8)) & 0xFF;
+		}
+	}
+}
+
+EPixelFormat FglTFRuntimeTextureCompressor::GetPixelFormat(const FglTFRuntimeMipMap& MipMap, const bool bNormalMap)
+{
+	if (bNormalMap)
+	{
+		return EPixelFormat::PF_BC5;
+	}
+
+	const FColor* Texels = reinterpret_cast<const FColor*>(MipMap.Pixels.GetData());
+	const int64 NumTexels = static_cast<int64>(MipMap.Width) * MipMap.Height;
+	for (int64 Index = 0; Index < NumTexels; Index++)
+	{
+		if (Texels[Index].A < 255)
+		{
+			return EPixelFormat::PF_DXT5;
+		}
+	}
+
+	return EPixelFormat::PF_DXT1;
+}
+
+bool FglTFRuntimeTextureCompressor::CompressMips(TArray<FglTFRuntimeMipMap>& Mips, const bool bNormalMap)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeTextureCompressor_CompressMips, FColor::Magenta);
+
+	// only uncompressed 8 bit textures with a block aligned top level are supported
+	if (Mips.Num() == 0 || Mips[0].PixelFormat != EPixelFormat::PF_B8G8R8A8 || (Mips[0].Width % 4) != 0 || (Mips[0].Height % 4) != 0)
+	{
+		return false;
+	}
+
+	return CompressMips(Mips, GetPixelFormat(Mips[0], bNormalMap));
+}
+
+bool FglTFRuntimeTextureCompressor::CompressMips(TArray<FglTFRuntimeMipMap>& Mips, const EPixelFormat PixelFormat)
+{
+	if (Mips.Num() == 0 || Mips[0].PixelFormat != EPixelFormat::PF_B8G8R8A8 || !GPixelFormats[PixelFormat].Supported)
+	{
+		return false;
+	}
+
+	if (PixelFormat != EPixelFormat::PF_DXT1 && PixelFormat != EPixelFormat::PF_DXT5 && PixelFormat != EPixelFormat::PF_BC5)
+	{
+		return false;
+	}
+
+	const int32 BlockBytes = GPixelFormats[PixelFormat].BlockBytes;
+
+	for (FglTFRuntimeMipMap& MipMap : Mips)
+	{
+		const int32 BlocksX = (MipMap.Width + 3) / 4;
+		const int32 BlocksY = (MipMap.Height + 3) / 4;
+		const FColor* Texels = reinterpret_cast<const FColor*>(MipMap.Pixels.GetData());
+
+		TArray64<uint8> Blocks;
+		Blocks.AddUninitialized(static_cast<int64>(BlocksX) * BlocksY * BlockBytes);
+
+		ParallelFor(BlocksY, [&](const int32 BlockY)
+			{
+				FColor BlockTexels[16];
+				uint8 Channels[2][16];
+				for (int32 BlockX = 0; BlockX < BlocksX; BlockX++)
+				{
+					// small mips are padded by clamping to the edge
+					for (int32 Y = 0; Y < 4; Y++)
+					{
+						const int32 TexelY = FMath::Min(BlockY * 4 + Y, MipMap.Height - 1);
+						for (int32 X = 0; X < 4; X++)
+						{
+							const int32 TexelX = FMath::Min(BlockX * 4 + X, MipMap.Width - 1);
+							BlockTexels[Y * 4 + X] = Texels[static_cast<int64>(TexelY) * MipMap.Width + TexelX];
+						}
+					}
+
+					uint8* Block = Blocks.GetData() + (static_cast<int64>(BlockY) * BlocksX + BlockX) * BlockBytes;
+					if (PixelFormat == EPixelFormat::PF_BC5)
+					{
+						for (int32 Index = 0; Index < 16; Index++)
+						{
+							Channels[0][Index] = BlockTexels[Index].R;
+							Channels[1][Index] = BlockTexels[Index].G;
+						}
+						glTFRuntimeBCn::EncodeValueBlock(Channels[0], Block);
+						glTFRuntimeBCn::EncodeValueBlock(Channels[1], Block + 8);
+					}
+					else if (PixelFormat == EPixelFormat::PF_DXT5)
+					{
+						for (int32 Index = 0; Index < 16; Index++)
+						{
+							Channels[0][Index] = BlockTexels[Index].A;
+						}
+						glTFRuntimeBCn::EncodeValueBlock(Channels[0], Block);
+						glTFRuntimeBCn::EncodeColorBlock(BlockTexels, Block + 8);
+					}
+					else
+					{
+						glTFRuntimeBCn::EncodeColorBlock(BlockTexels, Block);
+					}
+				}
+			});
+
+		MipMap.Pixels = MoveTemp(Blocks);
+		MipMap.PixelFormat = PixelFormat;
+	}
+
+	return true;
+}
+
+bool FglTFRuntimeTextureStreamingSource::DecodeMips(const int32 FirstMipIndex, const int32 LastMipIndex, TArray<FglTFRuntimeMipMap>& OutMips) const
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeTextureStreamingSource_DecodeMips, FColor::Magenta);
+
+	if (!EncodedBytes || FirstMipIndex < 0 || LastMipIndex < FirstMipIndex || LastMipIndex >= NumStreamedMips)
+	{
+		return false;
+	}
+
+	const int32 NumMips = LastMipIndex + 1;
+
+	// DDS stores the chain, only the requested levels are read
+	TArray<FglTFRuntimeMipMap> Mips;
+	if (MaterialsConfig.bLoadMipMaps)
+	{
+		if (FglTFRuntimeDDS::IsDDS(*EncodedBytes))
+		{
+			FglTFRuntimeDDS DDS(*EncodedBytes);
+			DDS.LoadMips(TextureIndex, Mips, NumMips, MaterialsConfig.ImagesConfig);
+		}
+	}
+
+	// other images always require the full decode, but the chain stops at the last requested level
+	if (Mips.Num() == 0)
+	{
+		TArray64<uint8> UncompressedBytes;
+		int32 Width = 0;
+		int32 Height = 0;
+		EPixelFormat DecodedPixelFormat;
+		FString Error;
+		if (!FglTFRuntimeParser::DecodeImage(*EncodedBytes, UncompressedBytes, Width, Height, DecodedPixelFormat, MaterialsConfig.ImagesConfig, Error))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to decode streamed texture %d: %s"), TextureIndex, *Error);
+			return false;
+		}
+
+		if (MaterialsConfig.ImagesConfig.bVerticalFlip)
+		{
+			glTFRuntimeMips::VerticalFlip(UncompressedBytes, Width, Height, DecodedPixelFormat);
+		}
+
+		glTFRuntimeMips::BuildMips(TextureIndex, MoveTemp(UncompressedBytes), Width, Height, DecodedPixelFormat, Mips, sRGB, MaterialsConfig, NumMips);
+	}
+
+	if (Mips.Num() < NumMips)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Streamed texture %d decoded to %d mips, %d expected"), TextureIndex, Mips.Num(), NumMips);
+		return false;
+	}
+
+	// the levels above the request are released right away (the top one is usually the biggest)
+	OutMips.Empty(NumMips - FirstMipIndex);
+	for (int32 MipIndex = FirstMipIndex; MipIndex < NumMips; MipIndex++)
+	{
+		OutMips.Add(MoveTemp(Mips[MipIndex]));
+	}
+	Mips.Empty();
+
+	if (OutMips[0].PixelFormat != PixelFormat && !FglTFRuntimeTextureCompressor::CompressMips(OutMips, PixelFormat))
+	{
+		OutMips.Empty();
+		return false;
+	}
+
+	return true;
+}
+
+void FglTFRuntimeParser::AddTextureStreamingSource(const int32 TextureIndex, TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> EncodedBytes, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+{
+	// the decoding hooks require the parser, those textures keep all of their bulk data
+	if (OnTextureMips.IsBound() || OnTexturePixels.IsBound() || OnLoadedTexturePixels.IsBound() || OnTextureFilterMips.IsBound())
+	{
+		return;
+	}
+
+	TSharedPtr<FglTFRuntimeTextureStreamingSource, ESPMode::ThreadSafe> StreamingSource = MakeShared<FglTFRuntimeTextureStreamingSource, ESPMode::ThreadSafe>();
+	StreamingSource->TextureIndex = TextureIndex;
+	StreamingSource->EncodedBytes = EncodedBytes;
+	StreamingSource->sRGB = sRGB;
+	// only the decoding options are required (the overrides maps reference UObjects)
+	StreamingSource->MaterialsConfig.bLoadMipMaps = MaterialsConfig.bLoadMipMaps;
+	StreamingSource->MaterialsConfig.bGeneratesMipMaps = MaterialsConfig.bGeneratesMipMaps;
+	StreamingSource->MaterialsConfig.ImagesConfig = MaterialsConfig.ImagesConfig;
+
+	FScopeLock Lock(&TextureStreamingSourcesLock);
+	TextureStreamingSources.Add(TPair<int32, bool>(TextureIndex, sRGB), StreamingSource);
+}
+
+static bool CopyStreamedMip(const FglTFRuntimeMipMap& MipMap, const FTextureMipInfo& MipInfo)
+{
+	const int64 NumBlocksX = FMath::DivideAndRoundUp<int64>(MipMap.Width, GPixelFormats[MipMap.PixelFormat].BlockSizeX);
+	const int64 NumBlocksY = FMath::DivideAndRoundUp<int64>(MipMap.Height, GPixelFormats[MipMap.PixelFormat].BlockSizeY);
+	const int64 Pitch = NumBlocksX * GPixelFormats[MipMap.PixelFormat].BlockBytes;
+	if (MipMap.PixelFormat != MipInfo.Format || MipMap.Pixels.Num() != Pitch * NumBlocksY || static_cast<int64>(MipInfo.DataSize) < MipMap.Pixels.Num() || MipInfo.DataSize % NumBlocksY != 0)
+	{
+		return false;
+	}
+
+	// the destination rows could be padded
+	const int64 DestPitch = MipInfo.DataSize / NumBlocksY;
+	if (DestPitch == Pitch)
+	{
+		FMemory::Memcpy(MipInfo.DestData, MipMap.Pixels.GetData(), MipMap.Pixels.Num());
+		return true;
+	}
+
+	for (int64 BlockY = 0; BlockY < NumBlocksY; BlockY++)
+	{
+		FMemory::Memcpy(reinterpret_cast<uint8*>(MipInfo.DestData) + DestPitch * BlockY, MipMap.Pixels.GetData() + Pitch * BlockY, Pitch);
+	}
+	return true;
+}
+
 int32 FglTFRuntimeTextureMipDataProvider::GetMips(const FTextureUpdateContext& Context, int32 StartingMipIndex, const FTextureMipInfoArray& MipInfos, const FTextureUpdateSyncOptions& SyncOptions)
 {
 #if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 26
 	const int32 CurrentFirstLODIdx = Context.CurrentFirstMipIndex;
 #endif
+	// decoded on the first mip without bulk data, freed once this request has copied them
+	TArray<FglTFRuntimeMipMap> StreamedMips;
+	int32 FirstStreamedMipIndex = INDEX_NONE;
+
 	for (int32 MipIndex = StartingMipIndex; MipIndex < CurrentFirstLODIdx; MipIndex++)
 	{
 #if ENGINE_MAJOR_VERSION >= 5 || ENGINE_MINOR_VERSION >= 27
@@ -1451,10 +2275,35 @@ int32 FglTFRuntimeTextureMipDataProvider::GetMips(const FTextureUpdateContext& C
 		if (ByteBulkData->GetBulkDataSize() > 0)
 		{
 			ByteBulkData->GetCopy(&Dest, false);
+			continue;
+		}
+
+		// mips without bulk data are decoded from the streaming source
+		if (!bMipsFailed && StreamingSource)
+		{
+			if (FirstStreamedMipIndex == INDEX_NONE)
+			{
+				FirstStreamedMipIndex = MipIndex;
+				// streamed mips are the top of the chain, the resident ones always have bulk data
+				StreamingSource->DecodeMips(FirstStreamedMipIndex, FMath::Min(CurrentFirstLODIdx, StreamingSource->NumStreamedMips) - 1, StreamedMips);
+			}
+
+			if (StreamedMips.IsValidIndex(MipIndex - FirstStreamedMipIndex) && CopyStreamedMip(StreamedMips[MipIndex - FirstStreamedMipIndex], MipInfo))
+			{
+				continue;
+			}
+		}
+
+		if (!bMipsFailed)
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to stream mip %d of texture %d"), MipIndex, StreamingSource ? StreamingSource->TextureIndex : INDEX_NONE);
+			bMipsFailed = true;
 		}
+		// never upload garbage (PollMips will cancel the update anyway)
+		FMemory::Memzero(Dest, MipInfo.DataSize);
 	}
 
-	AdvanceTo(ETickState::CleanUp, ETickThread::Async);
+	AdvanceTo(ETickState::PollMips, ETickThread::Async);
 	return CurrentFirstLODIdx;
 }
 
@@ -64,15 +64,15 @@ struct FglTFRuntimeSkeletalMeshContextFinalizer
 
 	~FglTFRuntimeSkeletalMeshContextFinalizer()
 	{
-		FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([this]()
+		// the finalizer is gone when the game thread runs the continuation, so copy what it needs
+		FglTFRuntimeParser::RunOnGameThread([SkeletalMeshContext = SkeletalMeshContext, AsyncCallback = AsyncCallback]()
 			{
 				if (SkeletalMeshContext->SkeletalMesh)
 				{
 					SkeletalMeshContext->SkeletalMesh = SkeletalMeshContext->Parser->FinalizeSkeletalMeshWithLODs(SkeletalMeshContext);
 				}
 				AsyncCallback.ExecuteIfBound(SkeletalMeshContext->SkeletalMesh);
-			}, TStatId(), nullptr, ENamedThreads::GameThread);
-		FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+			});
 	}
 };
 
@@ -349,6 +349,9 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 
 	OnPreCreatedSkeletalMesh.Broadcast(SkeletalMeshContext);
 
+	SkeletalMeshContext->LODsSectionsVertices.Empty();
+	SkeletalMeshContext->LODsSectionsVertices.SetNum(SkeletalMeshContext->LODs.Num());
+
 	for (FglTFRuntimeMeshLOD* LOD : SkeletalMeshContext->LODs)
 	{
 		LOD->bHasTangents = true;
@@ -362,11 +365,16 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 
 		bool bUseHighPrecisionUVs = false;
 		bool bUseHighPrecisionWeights = false;
+		bool bMissingNormals = false;
 
 		int32 NumIndices = 0;
 		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD->Primitives.Num(); PrimitiveIndex++)
 		{
 			NumIndices += LOD->Primitives[PrimitiveIndex].Indices.Num();
+			if (LOD->Primitives[PrimitiveIndex].Normals.Num() < LOD->Primitives[PrimitiveIndex].Positions.Num())
+			{
+				bMissingNormals = true;
+			}
 			if (LOD->Primitives[PrimitiveIndex].bHighPrecisionUVs)
 			{
 				bUseHighPrecisionUVs = true;
@@ -381,12 +389,62 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 			}
 		}
 
-		LodRenderData->StaticVertexBuffers.PositionVertexBuffer.Init(NumIndices);
+		const bool bGenerateNormals = SkeletalMeshContext->SkeletalMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always ||
+			(bMissingNormals && SkeletalMeshContext->SkeletalMeshConfig.NormalsGenerationStrategy != EglTFRuntimeNormalsGenerationStrategy::Never);
+
+		// flat normals require a vertex per triangle corner, otherwise we keep the glTF topology
+		// (each section gets only the vertices referenced by its primitive, in first-use order)
+		const bool bIndexed = !bGenerateNormals;
+
+		TArray<TArray<uint32>>& SectionsVertices = SkeletalMeshContext->LODsSectionsVertices[LODIndex];
+		SectionsVertices.SetNum(LOD->Primitives.Num());
+
+		TArray<uint32> LODIndices;
+		LODIndices.Reserve(NumIndices);
+
+		int32 NumVertices = 0;
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD->Primitives.Num(); PrimitiveIndex++)
+		{
+			const FglTFRuntimePrimitive& Primitive = LOD->Primitives[PrimitiveIndex];
+			TArray<uint32>& SectionVertices = SectionsVertices[PrimitiveIndex];
+
+			if (bIndexed)
+			{
+				TArray<int32> VertexRemap;
+				VertexRemap.Init(INDEX_NONE, Primitive.Positions.Num());
+				for (const uint32 VertexIndex : Primitive.Indices)
+				{
+					if (VertexIndex >= static_cast<uint32>(Primitive.Positions.Num()))
+					{
+						AddError("CreateSkeletalMeshFromLODs()", FString::Printf(TEXT("Invalid vertex index %u"), VertexIndex));
+						return nullptr;
+					}
+					int32& RemappedIndex = VertexRemap[VertexIndex];
+					if (RemappedIndex == INDEX_NONE)
+					{
+						RemappedIndex = SectionVertices.Add(VertexIndex);
+					}
+					LODIndices.Add(NumVertices + RemappedIndex);
+				}
+			}
+			else
+			{
+				SectionVertices = Primitive.Indices;
+				for (int32 Index = 0; Index < Primitive.Indices.Num(); Index++)
+				{
+					LODIndices.Add(NumVertices + Index);
+				}
+			}
+
+			NumVertices += SectionVertices.Num();
+		}
+
+		LodRenderData->StaticVertexBuffers.PositionVertexBuffer.Init(NumVertices);
 		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetUseFullPrecisionUVs(bUseHighPrecisionUVs || SkeletalMeshContext->SkeletalMeshConfig.bUseHighPrecisionUVs);
-		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.Init(NumIndices, 1);
+		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.Init(NumVertices, 1);
 		if (LOD->bHasVertexColors)
 		{
-			LodRenderData->StaticVertexBuffers.ColorVertexBuffer.Init(NumIndices);
+			LodRenderData->StaticVertexBuffers.ColorVertexBuffer.Init(NumVertices);
 		}
 
 		int32 NumBones = RefSkeleton.GetNum();
@@ -398,10 +456,10 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 		}
 
 		TArray<FSkinWeightInfo> InWeights;
-		InWeights.AddZeroed(NumIndices);
+		InWeights.AddZeroed(NumVertices);
 
 		int32 TotalVertexIndex = 0;
-		int32 Base = 0;
+		int32 TotalIndex = 0;
 		int32 MaxBoneInfluences = 4;
 
 		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD->Primitives.Num(); PrimitiveIndex++)
@@ -412,9 +470,9 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 			FSkelMeshRenderSection& MeshSection = LodRenderData->RenderSections[PrimitiveIndex];
 
 			MeshSection.MaterialIndex = PrimitiveIndex;
-			MeshSection.BaseIndex = TotalVertexIndex;
+			MeshSection.BaseIndex = TotalIndex;
 			MeshSection.NumTriangles = Primitive.Indices.Num() / 3;
-			MeshSection.BaseVertexIndex = Base;
+			MeshSection.BaseVertexIndex = TotalVertexIndex;
 			MeshSection.MaxBoneInfluences = FMath::Min(Primitive.Joints.Num() * 4, MAX_TOTAL_INFLUENCES);
 
 			if (MeshSection.MaxBoneInfluences > MaxBoneInfluences)
@@ -422,9 +480,7 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 				MaxBoneInfluences = MeshSection.MaxBoneInfluences;
 			}
 
-			MeshSection.NumVertices = Primitive.Indices.Num();
-
-			Base += MeshSection.NumVertices;
+			MeshSection.NumVertices = SectionsVertices[PrimitiveIndex].Num();
 
 			TMap<int32, TArray<int32>> OverlappingVertices;
 			MeshSection.DuplicatedVerticesBuffer.Init(MeshSection.NumVertices, OverlappingVertices);
@@ -432,8 +488,14 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 			// this is used for non-skinned asset loaded as skinned ones
 			int32 OverrideIndexToCheck = 0;
 
+			// walk the index stream (node based bone maps are keyed by index), vertices are emitted on first use
 			for (int32 VertexIndex = 0; VertexIndex < Primitive.Indices.Num(); VertexIndex++)
 			{
+				if (LODIndices[TotalIndex + VertexIndex] != static_cast<uint32>(TotalVertexIndex))
+				{
+					continue;
+				}
+
 				int32 Index = Primitive.Indices[VertexIndex];
 				FModelVertex ModelVertex;
 
@@ -617,6 +679,8 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 				TotalVertexIndex++;
 			}
 
+			TotalIndex += Primitive.Indices.Num();
+
 			for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
 			{
 				MeshSection.BoneMap.Add(BoneIndex);
@@ -641,7 +705,7 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 			LOD->bHasTangents = true;
 		}
 
-		if ((!LOD->bHasTangents || !LOD->bHasNormals) && TotalVertexIndex % 3 == 0)
+		if ((!LOD->bHasTangents || !LOD->bHasNormals) && LODIndices.Num() % 3 == 0)
 		{
 
 			//normals with NaNs are incorrectly handled on Android
@@ -654,130 +718,119 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 					}
 				};
 
-			for (int32 VertexIndex = 0; VertexIndex < TotalVertexIndex; VertexIndex += 3)
+			// if we do not have tangents but we have normals and a UV channel, we can compute them
+			// (triangle tangents are accumulated on shared vertices, on de-indexed LODs this is a plain assignment)
+			const bool bGenerateTangents = !LOD->bHasTangents && LOD->bHasUV;
+			TArray<FVector> TangentsAccumulator;
+			if (bGenerateTangents)
 			{
+				TangentsAccumulator.AddZeroed(NumVertices);
+			}
 
-#if ENGINE_MAJOR_VERSION > 4
-				FVector Position0 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex));
-				FVector4 TangentZ0 = FVector4(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex));
-#else
-				FVector Position0 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex);
-				FVector4 TangentZ0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex);
-#endif
-
-
-#if ENGINE_MAJOR_VERSION > 4
-				FVector Position1 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex + 1));
-				FVector4 TangentZ1 = FVector4(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex + 1));
-#else
-				FVector Position1 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex + 1);
-				FVector4 TangentZ1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex + 1);
-#endif
-
+			for (int32 Index = 0; Index < LODIndices.Num(); Index += 3)
+			{
+				const uint32 VertexIndex0 = LODIndices[Index];
+				const uint32 VertexIndex1 = LODIndices[Index + 1];
+				const uint32 VertexIndex2 = LODIndices[Index + 2];
 
 #if ENGINE_MAJOR_VERSION > 4
-				FVector Position2 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex + 2));
-				FVector4 TangentZ2 = FVector4(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex + 2));
+				FVector Position0 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex0));
+				FVector Position1 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex1));
+				FVector Position2 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex2));
 #else
-				FVector Position2 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex + 2);
-				FVector4 TangentZ2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex + 2);
+				FVector Position0 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex0);
+				FVector Position1 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex1);
+				FVector Position2 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex2);
 #endif
 
-				if (!LOD->bHasNormals)
+				// flat normals are generated only on de-indexed LODs (vertices are never shared)
+				if (!LOD->bHasNormals && !bIndexed)
 				{
 					const FVector SideA = Position1 - Position0;
 					const FVector SideB = Position2 - Position0;
 
 					const FVector NormalFromCross = FVector::CrossProduct(SideB, SideA).GetSafeNormal();
 
-					TangentZ0 = NormalFromCross;
-					TangentZ1 = NormalFromCross;
-					TangentZ2 = NormalFromCross;
+					for (const uint32 VertexIndex : { VertexIndex0, VertexIndex1, VertexIndex2 })
+					{
+#if ENGINE_MAJOR_VERSION > 4
+						FVector4f TangentX = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex);
+						FVector3f TangentY = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex);
+						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, TangentX, TangentY, FVector3f(NormalFromCross));
+#else
+						FVector4 TangentX = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex);
+						FVector TangentY = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex);
+						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, TangentX, TangentY, NormalFromCross);
+#endif
+					}
 				}
 
-				// if we do not have tangents but we have normals and a UV channel, we can compute them
-				if (!LOD->bHasTangents && LOD->bHasUV)
+				if (bGenerateTangents)
 				{
 					FVector DeltaPosition0 = Position1 - Position0;
 					FVector DeltaPosition1 = Position2 - Position0;
 
-
 #if ENGINE_MAJOR_VERSION > 4
-					const FVector2f& UV0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex, 0);
-					const FVector2f& UV1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex + 1, 0);
-					const FVector2f& UV2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex + 2, 0);
+					const FVector2f& UV0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex0, 0);
+					const FVector2f& UV1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex1, 0);
+					const FVector2f& UV2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex2, 0);
 					FVector2f DeltaUV0 = UV1 - UV0;
 					FVector2f DeltaUV1 = UV2 - UV0;
 #else
-					const FVector2D& UV0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex, 0);
-					const FVector2D& UV1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex + 1, 0);
-					const FVector2D& UV2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex + 2, 0);
+					const FVector2D& UV0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex0, 0);
+					const FVector2D& UV1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex1, 0);
+					const FVector2D& UV2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex2, 0);
 					FVector2D DeltaUV0 = UV1 - UV0;
 					FVector2D DeltaUV1 = UV2 - UV0;
 #endif
 
-					float Factor = 1.0f / (DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X);
+					const float Determinant = DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X;
+					// skip degenerate uv triangles (they would poison shared vertices)
+					if (FMath::IsNearlyZero(Determinant))
+					{
+						continue;
+					}
 
-					FVector TriangleTangentX = ((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor;
-					FVector TriangleTangentY = ((DeltaPosition0 * DeltaUV1.X) - (DeltaPosition1 * DeltaUV0.X)) * Factor;
+					float Factor = 1.0f / Determinant;
 
-					FVector TangentX0 = TriangleTangentX - (TangentZ0 * FVector::DotProduct(TangentZ0, TriangleTangentX));
-					TangentX0.Normalize();
+					FVector TriangleTangentX = (((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor).GetSafeNormal();
 
-					FVector TangentX1 = TriangleTangentX - (TangentZ1 * FVector::DotProduct(TangentZ1, TriangleTangentX));
-					TangentX1.Normalize();
+					TangentsAccumulator[VertexIndex0] += TriangleTangentX;
+					TangentsAccumulator[VertexIndex1] += TriangleTangentX;
+					TangentsAccumulator[VertexIndex2] += TriangleTangentX;
+				}
+			}
 
-					FVector TangentX2 = TriangleTangentX - (TangentZ2 * FVector::DotProduct(TangentZ2, TriangleTangentX));
-					TangentX2.Normalize();
+			if (bGenerateTangents)
+			{
+				for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+				{
+					if (TangentsAccumulator[VertexIndex].IsNearlyZero())
+					{
+						continue;
+					}
 
-#if PLATFORM_ANDROID
-					FixVectorIfNan(TangentX0, 0);
-					FixVectorIfNan(TangentX1, 0);
-					FixVectorIfNan(TangentX2, 0);
+#if ENGINE_MAJOR_VERSION > 4
+					const FVector TangentZ = FVector(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex));
+#else
+					const FVector TangentZ = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex);
 #endif
 
-					FVector TangentY0 = ComputeTangentY(TangentZ0, TangentX0) * TangentsDirection;
-					FVector TangentY1 = ComputeTangentY(TangentZ1, TangentX1) * TangentsDirection;
-					FVector TangentY2 = ComputeTangentY(TangentZ2, TangentX2) * TangentsDirection;
+					FVector TangentX = TangentsAccumulator[VertexIndex] - (TangentZ * FVector::DotProduct(TangentZ, TangentsAccumulator[VertexIndex]));
+					TangentX.Normalize();
 #if PLATFORM_ANDROID
-					FixVectorIfNan(TangentY0, 1);
-					FixVectorIfNan(TangentY1, 1);
-					FixVectorIfNan(TangentY2, 1);
+					FixVectorIfNan(TangentX, 0);
 #endif
 
+					FVector TangentY = ComputeTangentY(TangentZ, TangentX) * TangentsDirection;
+#if PLATFORM_ANDROID
+					FixVectorIfNan(TangentY, 1);
+#endif
 
 #if ENGINE_MAJOR_VERSION > 4
-					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, FVector3f(TangentX0), FVector3f(TangentY0), FVector3f(FVector(TangentZ0)));
-					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 1, FVector3f(TangentX1), FVector3f(TangentY1), FVector3f(FVector(TangentZ1)));
-					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 2, FVector3f(TangentX2), FVector3f(TangentY2), FVector3f(FVector(TangentZ2)));
+					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, FVector3f(TangentX), FVector3f(TangentY), FVector3f(TangentZ));
 #else
-					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, TangentX0, TangentY0, TangentZ0);
-					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 1, TangentX1, TangentY1, TangentZ1);
-					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 2, TangentX2, TangentY2, TangentZ2);
-#endif
-				}
-				else if (!LOD->bHasNormals) // if we are here we need to reapply normals
-				{
-#if ENGINE_MAJOR_VERSION > 4
-					FVector4f TangentX0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex);
-					FVector4f TangentX1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex + 1);
-					FVector4f TangentX2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex + 2);
-					FVector3f TangentY0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex);
-					FVector3f TangentY1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex + 1);
-					FVector3f TangentY2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex + 2);
-					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, TangentX0, TangentY0, FVector4f(TangentZ0));
-					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 1, TangentX1, TangentY1, FVector4f(TangentZ1));
-					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 2, TangentX2, TangentY2, FVector4f(TangentZ2));
-#else
-					FVector4 TangentX0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex);
-					FVector4 TangentX1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex + 1);
-					FVector4 TangentX2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex + 2);
-					FVector TangentY0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex);
-					FVector TangentY1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex + 1);
-					FVector TangentY2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex + 2);
-					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, TangentX0, TangentY0, TangentZ0);
-					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 1, TangentX1, TangentY1, TangentZ1);
-					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 2, TangentX2, TangentY2, TangentZ2);
+					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, TangentX, TangentY, TangentZ);
 #endif
 				}
 			}
@@ -804,12 +857,8 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 
 		LodRenderData->SkinWeightVertexBuffer = InWeights;
 #endif
-		LodRenderData->MultiSizeIndexContainer.CreateIndexBuffer(NumIndices > MAX_uint16 ? sizeof(uint32) : sizeof(uint16));
-
-		for (int32 Index = 0; Index < NumIndices; Index++)
-		{
-			LodRenderData->MultiSizeIndexContainer.GetIndexBuffer()->AddItem(Index);
-		}
+		// index size depends on the number of addressed vertices, not on the number of indices
+		LodRenderData->MultiSizeIndexContainer.RebuildIndexBuffer(NumVertices > MAX_uint16 ? sizeof(uint32) : sizeof(uint16), LODIndices);
 
 	}
 
@@ -818,6 +867,14 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 
 USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext)
 {
+	// primitives decoded on a worker only carry the material index
+	for (FglTFRuntimeMeshLOD* LOD : SkeletalMeshContext->LODs)
+	{
+		if (!ResolvePendingMaterials(*LOD, SkeletalMeshContext->SkeletalMeshConfig.MaterialsConfig))
+		{
+			return nullptr;
+		}
+	}
 
 #if WITH_EDITOR
 	FSkeletalMeshModel* ImportedResource = SkeletalMeshContext->SkeletalMesh->GetImportedModel();
@@ -893,17 +950,21 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 
 				FglTFRuntimePrimitive& Primitive = SkeletalMeshContext->LODs[LODIndex]->Primitives[PrimitiveIndex];
 
+				// morph targets deltas are mapped to the render vertices built by CreateSkeletalMeshFromLODs()
+				const TArray<uint32>& SectionVertices = SkeletalMeshContext->LODsSectionsVertices.IsValidIndex(LODIndex) && SkeletalMeshContext->LODsSectionsVertices[LODIndex].IsValidIndex(PrimitiveIndex) ?
+					SkeletalMeshContext->LODsSectionsVertices[LODIndex][PrimitiveIndex] : Primitive.Indices;
+
 				for (FglTFRuntimeMorphTarget& MorphTargetData : Primitive.MorphTargets)
 				{
 					bool bSkip = true;
 					FMorphTargetLODModel MorphTargetLODModel;
-					MorphTargetLODModel.NumBaseMeshVerts = Primitive.Indices.Num();
+					MorphTargetLODModel.NumBaseMeshVerts = SectionVertices.Num();
 					MorphTargetLODModel.SectionIndices.Add(PrimitiveIndex);
 
-					for (int32 Index = 0; Index < Primitive.Indices.Num(); Index++)
+					for (int32 Index = 0; Index < SectionVertices.Num(); Index++)
 					{
 						FMorphTargetDelta Delta;
-						int32 VertexIndex = Primitive.Indices[Index];
+						int32 VertexIndex = SectionVertices[Index];
 						if (VertexIndex < MorphTargetData.Positions.Num())
 						{
 #if ENGINE_MAJOR_VERSION > 4
@@ -1011,7 +1072,7 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 
 					MorphTargetIndex++;
 				}
-				BaseIndex += Primitive.Indices.Num();
+				BaseIndex += SectionVertices.Num();
 			}
 		}
 
@@ -1629,7 +1690,7 @@ void FglTFRuntimeParser::LoadSkeletalMeshAsync(const int32 MeshIndex, const int3
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), SkeletalMeshConfig);
 	SkeletalMeshContext->SkinIndex = SkinIndex;
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, MeshIndex, AsyncCallback]()
+	RunOnWorkerPool([this, SkeletalMeshContext, MeshIndex, AsyncCallback]()
 		{
 			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
 
@@ -1709,7 +1770,7 @@ void FglTFRuntimeParser::LoadSkeletalMeshRecursiveAsync(const FString& NodeName,
 {
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), SkeletalMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, TransformApplyRecursiveMode]()
+	RunOnWorkerPool([this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, TransformApplyRecursiveMode]()
 		{
 			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
 			// ensure to cache it as the finalizer requires LOD access
@@ -3405,23 +3466,25 @@ bool FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& Nod
 	// TODO: support skeletalmeshes too
 	if (SkinIndex <= INDEX_NONE && MaterialsConfig.bMergeSectionsByMaterial)
 	{
-		TMap<UMaterialInterface*, TArray<FglTFRuntimePrimitive>> PrimitivesMap;
+		// pending materials all share the default material, so group them by material index too
+		TMap<TPair<UMaterialInterface*, int64>, TArray<FglTFRuntimePrimitive>> PrimitivesMap;
 		for (FglTFRuntimePrimitive& Primitive : RuntimeLOD.Primitives)
 		{
-			if (PrimitivesMap.Contains(Primitive.Material))
+			const TPair<UMaterialInterface*, int64> MaterialKey(Primitive.Material, Primitive.bMaterialPending ? Primitive.MaterialIndex : INDEX_NONE);
+			if (PrimitivesMap.Contains(MaterialKey))
 			{
-				PrimitivesMap[Primitive.Material].Add(Primitive);
+				PrimitivesMap[MaterialKey].Add(Primitive);
 			}
 			else
 			{
 				TArray<FglTFRuntimePrimitive> NewPrimitives;
 				NewPrimitives.Add(Primitive);
-				PrimitivesMap.Add(Primitive.Material, NewPrimitives);
+				PrimitivesMap.Add(MaterialKey, NewPrimitives);
 			}
 		}
 
 		TArray<FglTFRuntimePrimitive> MergedPrimitives;
-		for (TPair<UMaterialInterface*, TArray<FglTFRuntimePrimitive>>& Pair : PrimitivesMap)
+		for (TPair<TPair<UMaterialInterface*, int64>, TArray<FglTFRuntimePrimitive>>& Pair : PrimitivesMap)
 		{
 			FglTFRuntimePrimitive MergedPrimitive;
 			if (MergePrimitives(Pair.Value, MergedPrimitive))
@@ -3533,9 +3596,8 @@ const FBox& FglTFRuntimeSkeletalMeshContext::GetBoneBox(const int32 BoneIndex)
 
 	const FSkeletalMeshLODRenderData& LOD0 = SkeletalMesh->GetResourceForRendering()->LODRenderData[0];
 	const uint32 NumVertices = LOD0.GetNumVertices();
-	for (uint32 Index = 0; Index < NumVertices; Index++)
+	for (uint32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
 	{
-		const uint32 VertexIndex = LOD0.MultiSizeIndexContainer.GetIndexBuffer()->Get(Index);
 
 		const uint32 MaxBoneInfluences = LOD0.SkinWeightVertexBuffer.GetMaxBoneInfluences();
 
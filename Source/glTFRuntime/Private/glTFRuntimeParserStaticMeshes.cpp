@@ -13,20 +13,45 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "StaticMeshResources.h"
-
-#define RESTRICT_POINTCLOUD_SIZE_FOR_TESTING_ON_LAPTOP true
+#include "glTFRuntimeLinesComponent.h"
+#include "glTFRuntimePointCloudComponent.h"
 
 #define MODE_POINTS 0
 #define MODE_LINES 1
 #define MODE_TRIANGLES 4
 
-#define GLYPHER_DEFAULT_MESH TEXT("StaticMesh'/glTFRuntime/SM_Sphere_glTFRuntime.SM_Sphere_glTFRuntime'")
-#define GLYPHER_SCALING_FACTOR 0.1f
+// incremental updates reuse the lines/point cloud component (and its resources) of the previous revision,
+// a mesh component has at most one of them, so any other one is stale
+template<typename T>
+static T* GetOrCreateHelperComponent(UStaticMeshComponent* StaticMeshComponent, const TCHAR* BaseName)
+{
+	T* HelperComponent = nullptr;
+	TArray<USceneComponent*> Children;
+	StaticMeshComponent->GetChildrenComponents(false, Children);
+	for (USceneComponent* Child : Children)
+	{
+		if (!HelperComponent && Child->IsA<T>())
+		{
+			HelperComponent = Cast<T>(Child);
+		}
+		else if (Child->IsA<UglTFRuntimeLinesComponent>() || Child->IsA<UglTFRuntimePointCloudComponent>())
+		{
+			Child->DestroyComponent();
+		}
+	}
+
+	if (!HelperComponent)
+	{
+		UObject* Outer = StaticMeshComponent->GetOwner() ? static_cast<UObject*>(StaticMeshComponent->GetOwner()) : static_cast<UObject*>(StaticMeshComponent);
+		HelperComponent = NewObject<T>(Outer, MakeUniqueObjectName(Outer, T::StaticClass(), BaseName));
+	}
 
-#define NUM_CUSTOM_FLOATS_PER_INSTANCE 4
+	return HelperComponent;
+}
 
 FglTFRuntimeStaticMeshContext::FglTFRuntimeStaticMeshContext(TSharedRef<FglTFRuntimeParser> InParser, const FglTFRuntimeStaticMeshConfig& InStaticMeshConfig) :
 	Parser(InParser),
+	LODsPin(InParser),
 	StaticMeshConfig(InStaticMeshConfig)
 {
 	StaticMesh = NewObject<UStaticMesh>(StaticMeshConfig.Outer ? StaticMeshConfig.Outer : GetTransientPackage(), NAME_None, RF_Public);
@@ -70,7 +95,7 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFR
 
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndex, AsyncCallback]()
+	RunOnWorkerPool([this, StaticMeshContext, MeshIndex, AsyncCallback]()
 		{
 
 			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
@@ -86,7 +111,7 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFR
 				}
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([MeshIndex, StaticMeshContext, AsyncCallback]()
+			RunOnGameThread([MeshIndex, StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
 					{
@@ -102,8 +127,7 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFR
 					}
 
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+				});
 		});
 }
 
@@ -118,7 +142,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 	OnPreCreatedStaticMesh.Broadcast(StaticMeshContext);
 
-	bFinalizeStaticMesh = true;
+	StaticMeshContext->bFinalizeStaticMesh = true;
 	UStaticMesh* StaticMesh = StaticMeshContext->StaticMesh;
 	FStaticMeshRenderData* RenderData = StaticMeshContext->RenderData;
 	const FglTFRuntimeStaticMeshConfig& StaticMeshConfig = StaticMeshContext->StaticMeshConfig;
@@ -167,15 +191,17 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 			NumVertexInstancesPerLOD += Primitive.Indices.Num();
 		}
 
+		// vertices are added per section (indexed sections only add the referenced glTF vertices)
 		TArray<FStaticMeshBuildVertex> StaticMeshBuildVertices;
-		StaticMeshBuildVertices.SetNum(NumVertexInstancesPerLOD);
+		LODIndices.Reserve(NumVertexInstancesPerLOD);
 
 		FBox BoundingBox;
 		BoundingBox.Init();
 
 		bool bHighPrecisionUVs = false;
 
-		int32 VertexInstanceBaseIndex = 0;
+		int32 IndexBaseIndex = 0;
+		int32 VertexBaseIndex = 0;
 
 		const bool bApplyAdditionalTransforms = LOD->Primitives.Num() == LOD->AdditionalTransforms.Num();
 
@@ -196,66 +222,43 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 			if (Primitive.Mode == MODE_LINES) 
 			{
-				const FTransform MeshTransform = FTransform(
-					StaticMeshComponent->GetComponentRotation(),
-					StaticMeshComponent->GetComponentLocation(), 
-					StaticMeshComponent->GetComponentScale()
-				);
-
-				// Create Niagara beam with that material.
-				UNiagaraSystem* NS = LoadObject<UNiagaraSystem>(nullptr, TEXT("/glTFRuntime/P_Line_glTFRuntime"), nullptr, LOAD_None, nullptr);
-
-				if (NS) 
+				// All of the segments of the primitive are drawn by a single lines component
+				// (spawning a Niagara beam per segment does not scale with the segment count).
+				// Segments are kept in local space, the component transform is applied while rendering.
+				UWorld* World = StaticMeshComponent->GetWorld();
+				if (World)
 				{
-					// Spawn beam between start and end of each line.
-					for (int32 LineIndex = 0; LineIndex < NumVertexInstancesPerSection / 2; LineIndex++) 
-					{
-						int32 VertexIndexStart = Primitive.Indices[LineIndex * 2];
-						FVector PositionStart = FVector(GetSafeValue(Primitive.Positions, VertexIndexStart, FVector::ZeroVector, bMissingIgnore));
-
-						int32 VertexIndexEnd = Primitive.Indices[LineIndex * 2 + 1];
-						FVector PositionEnd = FVector(GetSafeValue(Primitive.Positions, VertexIndexEnd, FVector::ZeroVector, bMissingIgnore));
-
-						// Lines and Points are not handled by UStaticMesh, therefore local2world transforms
-						// applied manually.
-						PositionStart = MeshTransform.TransformPosition(PositionStart);
-						PositionEnd = MeshTransform.TransformPosition(PositionEnd);
-						 
-						FVector Diff = PositionEnd - PositionStart;
-						FVector UnitDiff = FVector(Diff);
-						UnitDiff.Normalize(0.00001f);
-
-						FRotator Rotation = FRotator(FQuat::FindBetweenNormals(FVector3d(1.0, 0.0, 0.0), UnitDiff));
-						UNiagaraComponent* Beam = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-							StaticMesh->GetWorld(), NS, PositionStart, Rotation, FVector::One(), true, true, ENCPoolMethod::AutoRelease, true);
-						
-						// Set length
-						Beam->SetVariableFloat("Length", Diff.Length());
-
-						// Set colour
-						if (!Primitive.Colors.IsEmpty())
-						{
-							FLinearColor StartColor = FLinearColor(Primitive.Colors[LineIndex * 2]).ToFColor(true);
-							FLinearColor EndColor = FLinearColor(Primitive.Colors[LineIndex * 2 + 1]).ToFColor(true);
+					UglTFRuntimeLinesComponent* LinesComponent = GetOrCreateHelperComponent<UglTFRuntimeLinesComponent>(StaticMeshComponent, TEXT("Lines"));
 
-							//// Colours are appearing too bright. Should they be squared, cubed?
-							//StartColor.R *= StartColor.R * StartColor.R;
-							//StartColor.G *= StartColor.G * StartColor.G;
-							//StartColor.B *= StartColor.B * StartColor.B;
+					const bool bHasColors = !Primitive.Colors.IsEmpty();
+					const int32 NumLines = NumVertexInstancesPerSection / 2;
 
-							//// Colours are appearing too bright. Should they be squared, cubed?
-							//EndColor.R *= EndColor.R * EndColor.R;
-							//EndColor.G *= EndColor.G * EndColor.G;
-							//EndColor.B *= EndColor.B * EndColor.B;
+					// the start and end colors are interpolated by the line list
+					TArray<FglTFRuntimeLine> Lines;
+					Lines.Reserve(NumLines);
 
-							Beam->SetVariableLinearColor("StartColor", StartColor);
-							Beam->SetVariableLinearColor("EndColor", EndColor);
-						}
+					for (int32 LineIndex = 0; LineIndex < NumLines; LineIndex++)
+					{
+						const int32 VertexIndexStart = Primitive.Indices[LineIndex * 2];
+						const int32 VertexIndexEnd = Primitive.Indices[LineIndex * 2 + 1];
+
+						FglTFRuntimeLine& Line = Lines.AddDefaulted_GetRef();
+						Line.Start = FVector(GetSafeValue(Primitive.Positions, VertexIndexStart, FVector::ZeroVector, bMissingIgnore));
+						Line.End = FVector(GetSafeValue(Primitive.Positions, VertexIndexEnd, FVector::ZeroVector, bMissingIgnore));
+						Line.StartColor = bHasColors ? FLinearColor(GetSafeValue(Primitive.Colors, VertexIndexStart, FVector4(1, 1, 1, 1), bMissingIgnore)).ToFColor(true) : FColor::White;
+						Line.EndColor = bHasColors ? FLinearColor(GetSafeValue(Primitive.Colors, VertexIndexEnd, FVector4(1, 1, 1, 1), bMissingIgnore)).ToFColor(true) : FColor::White;
+					}
+
+					LinesComponent->SetLines(MoveTemp(Lines));
+					if (!LinesComponent->IsRegistered())
+					{
+						LinesComponent->SetupAttachment(StaticMeshComponent);
+						LinesComponent->RegisterComponentWithWorld(World);
 					}
 				}
 				else 
 				{
-					UE_LOG(LogTemp, Log, TEXT("Failed to create NiagaraSystem with Line. :("));
+					UE_LOG(LogTemp, Log, TEXT("Failed to create lines component, no world available. :("));
 				}
 
 				return nullptr;
@@ -264,30 +267,17 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 			if (Primitive.Mode == MODE_POINTS) 
 			{
-				const FTransform MeshTransform = FTransform(
-					StaticMeshComponent->GetComponentRotation(),
-					StaticMeshComponent->GetComponentLocation(),
-					StaticMeshComponent->GetComponentScale()
-				);
-
 				// In future, Glypher qualities will be sent via glTF.
-				// For now, just have that be set client side.
-				bool bGlyphers = true;
-
-				// I'm getting crashes on my laptop due to large pointclouds with InstancedStaticMesh.
-				// Note that this hasn't happened with the particle system.
-				// Also note that the particle system isn't currently working due to a memory bug :(.
-				// Try particle system for large pointclouds
-				if (RESTRICT_POINTCLOUD_SIZE_FOR_TESTING_ON_LAPTOP && NumVertexInstancesPerSection > 1000)
-				{
-					UE_LOG(LogTemp, Log, TEXT("Large pointcloud (size %d) ignored due to computer constraints."), NumVertexInstancesPerSection);
-					bGlyphers = false;
-					return nullptr; // Comment this line out to try rendering particles.
-				}
+				// For now, the rendering path is chosen by the point cloud config.
+				const FglTFRuntimePointCloudConfig& PointCloudConfig = StaticMeshConfig.PointCloudConfig;
+				const EglTFRuntimePointCloudMode PointCloudMode = PointCloudConfig.SelectMode(NumVertexInstancesPerSection);
 
 				// Glyphers use instanced rendering do render many objects.
-				if (bGlyphers)
+				if (PointCloudMode == EglTFRuntimePointCloudMode::Glyphs)
 				{
+					// material custom data layout: [R, G, B, A]
+					constexpr int32 NumCustomFloatsPerInstance = 4;
+
 					// Use instanced mesh for optimal rendering.
 					TArray<USceneComponent*> Parents;
 					StaticMeshComponent->GetParentComponents(Parents);
@@ -296,125 +286,159 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 					// Assume glyphs are spheres
 					// Note this redefines StaticMesh, meaning StaticMeshContext needs to be suitably updated.
-					StaticMesh = LoadObject<UStaticMesh>(Parents[0], GLYPHER_DEFAULT_MESH);
+					StaticMesh = PointCloudConfig.GlyphMesh ? PointCloudConfig.GlyphMesh : LoadObject<UStaticMesh>(Parents[0], TEXT("StaticMesh'/glTFRuntime/SM_Sphere_glTFRuntime.SM_Sphere_glTFRuntime'"));
 					StaticMeshContext->StaticMesh = StaticMesh;
-					bFinalizeStaticMesh = false;
+					StaticMeshContext->bFinalizeStaticMesh = false;
 
-					InstancedStaticMeshComponent->NumCustomDataFloats = NUM_CUSTOM_FLOATS_PER_INSTANCE;
+					InstancedStaticMeshComponent->NumCustomDataFloats = NumCustomFloatsPerInstance;
 
-					TArray<FVector> Positions;
-					Positions.Init(FVector::ZeroVector, NumVertexInstancesPerSection);
-					TArray<FLinearColor> Colors;
-					Colors.Init(FLinearColor::Green, NumVertexInstancesPerSection);
+					// The base static mesh is very large, therefore it must be scaled down.
+					// Currently, a copy of the default engine sphere is used (with custom material).
+					// Perhaps, in future, a specially designed mesh should be used instead.
+					const FVector GlyphScale = PointCloudConfig.GlyphScale * FVector::One();
 
-					// Collect points.
+					// Build all of the transforms in one pass, adding instances one by one
+					// invalidates the component state for every point.
+					TArray<FTransform> InstanceTransforms;
+					InstanceTransforms.Reserve(NumVertexInstancesPerSection);
 					for (int32 PointIndex = 0; PointIndex < NumVertexInstancesPerSection; PointIndex++)
 					{
 						int32 VertexIndexStart = Primitive.Indices[PointIndex];
 
 						FVector Position = FVector(GetSafeValue(Primitive.Positions, VertexIndexStart, FVector::ZeroVector, bMissingIgnore));
-						FLinearColor Color;
 
 						// MINOR ISSUE: Glyphs are not appearing as a subobject of the correct component.
-						// This isn't a big concern, but it means we may have to apply this transformation manually.
-						//Position = MeshTransform.TransformPosition(Position);
-
-						// The base static mesh is very large, therefore it must be scaled down.
-						// Currently, a copy of the default engine sphere is used (with custom material).
-						// Perhaps, in future, a specially designed mesh should be used instead.
-						float Scale = GLYPHER_SCALING_FACTOR;
-						FTransform Transform = FTransform(Position);
-						Transform.SetScale3D(Scale * FVector::One());
+						// Instance transforms are relative to the instanced component, so this only affects the hierarchy.
 
-						// In future, a rotation may be applied to Transform in order to render vector (arrow) glyphers.
-						// Something like, Transform.SetRotation(some rotation);
+						// In future, a rotation may be applied here in order to render vector (arrow) glyphers.
+						InstanceTransforms.Emplace(FQuat::Identity, Position, GlyphScale);
+					}
 
-						int32 InstanceIndex = InstancedStaticMeshComponent->AddInstance(Transform);
+					InstancedStaticMeshComponent->AddInstances(InstanceTransforms, false);
 
-						// Add colors to custom data.
-						// For each instance, custom data: [R, G, B, A]
-						if (!Primitive.Colors.IsEmpty())
+					// Add colors to custom data, written straight into the per instance storage
+					// (already sized by AddInstances). For each instance, custom data: [R, G, B, A]
+					if (!Primitive.Colors.IsEmpty())
+					{
+						float* CustomData = InstancedStaticMeshComponent->PerInstanceSMCustomData.GetData();
+						for (int32 PointIndex = 0; PointIndex < NumVertexInstancesPerSection; PointIndex++)
 						{
-							Color = FLinearColor(Primitive.Colors[PointIndex]).ToFColor(true);
-
-							//// Colours are appearing too bright. Should they be squared, cubed?
-							//Color.R *= Color.R * Color.R;
-							//Color.G *= Color.G * Color.G;
-							//Color.B *= Color.B * Color.B;
-
-							TArray<float> ColorArray;
-							ColorArray.Init(0.0f, 4);
-							ColorArray[0] = Color.R;
-							ColorArray[1] = Color.G;
-							ColorArray[2] = Color.B;
-							ColorArray[3] = Color.A;
-
-							InstancedStaticMeshComponent->SetCustomData(InstanceIndex, ColorArray);
+							// colors are indexed like the positions
+							const int32 VertexIndex = Primitive.Indices[PointIndex];
+							if (!Primitive.Colors.IsValidIndex(VertexIndex))
+							{
+								continue;
+							}
+							const FLinearColor Color = FLinearColor(Primitive.Colors[VertexIndex]).ToFColor(true);
+
+							float* InstanceCustomData = CustomData + PointIndex * NumCustomFloatsPerInstance;
+							InstanceCustomData[0] = Color.R;
+							InstanceCustomData[1] = Color.G;
+							InstanceCustomData[2] = Color.B;
+							InstanceCustomData[3] = Color.A;
 						}
-
-						// NOTE FOR FUTURE PROGRAMMERS: If you want to make greater use of 
-						// static mesh instance custom data (for instance: radius),
-						// you will need to adjust the material used by the base static mesh:
-						// glTFRuntime/M_GlypherBase_glTFRuntime
+						InstancedStaticMeshComponent->MarkRenderStateDirty();
 					}
+
+					// NOTE FOR FUTURE PROGRAMMERS: If you want to make greater use of 
+					// static mesh instance custom data (for instance: radius),
+					// you will need to adjust the material used by the base static mesh:
+					// glTFRuntime/M_GlypherBase_glTFRuntime
 					StaticMeshComponent = InstancedStaticMeshComponent;
 					
 					return StaticMesh;
 				}
 
 
-				UNiagaraSystem* NS = LoadObject<UNiagaraSystem>(nullptr, TEXT("/glTFRuntime/P_Point_glTFRuntime"), nullptr, LOAD_None, nullptr);
+				UNiagaraSystem* NS = PointCloudConfig.NiagaraSystem;
+				if (!NS)
+				{
+					NS = LoadObject<UNiagaraSystem>(nullptr, TEXT("/glTFRuntime/P_Point_glTFRuntime"), nullptr, LOAD_None, nullptr);
+				}
 
 				if (NS) 
 				{
-					// Each element of Positions or Colors is one component of a Vector4.
-					// i.e. Positions[4*n]     = X,		Colours[4*n]     = B
-					//      Positions[4*n + 1] = Y,		Colours[4*n + 1] = G
-					//      Positions[4*n + 2] = Z,		Colours[4*n + 2] = R
-					//      Positions[4*n + 3] =  ,		Colours[4*n + 3] = A
-					TArray<float> Positions;
-					Positions.Init(0.0f, NumVertexInstancesPerSection * 4);
-					TArray<uint8_t> Colors;
-					Colors.Init(0, NumVertexInstancesPerSection * 4);
-
-					// Spawn particle for each point.
-					// NOTE: Glyphers are not yet supported.
+					// points usually have no indices, in that case the decoded positions are quantized as they are
+					bool bIdentityIndices = Primitive.Indices.Num() == Primitive.Positions.Num();
+					for (int32 PointIndex = 0; bIdentityIndices && PointIndex < NumVertexInstancesPerSection; PointIndex++)
+					{
+						bIdentityIndices = Primitive.Indices[PointIndex] == static_cast<uint32>(PointIndex);
+					}
+					TArray<FVector> IndexedPositions;
+					if (!bIdentityIndices)
+					{
+						IndexedPositions.AddUninitialized(NumVertexInstancesPerSection);
+					}
+					TArray<FColor> Colors;
+					Colors.Init(FColor::White, Primitive.Colors.IsEmpty() ? 0 : NumVertexInstancesPerSection);
+					TMap<FString, TArray<float>> Attributes;
+					// source and destination of each custom attribute (avoids map lookups per point)
+					TArray<TPair<const TArray<float>*, float*>> AttributesData;
+					for (const TPair<FString, TArray<float>>& Pair : Primitive.CustomAttributes)
+					{
+						Attributes.Add(Pair.Key).AddUninitialized(NumVertexInstancesPerSection);
+					}
+					for (const TPair<FString, TArray<float>>& Pair : Primitive.CustomAttributes)
+					{
+						AttributesData.Add(TPair<const TArray<float>*, float*>(&Pair.Value, Attributes[Pair.Key].GetData()));
+					}
 
 					// Collect points.
 					for (int32 PointIndex = 0; PointIndex < NumVertexInstancesPerSection; PointIndex++)
 					{
 						int32 VertexIndexStart = Primitive.Indices[PointIndex];
 
-						FVector Position = FVector(GetSafeValue(Primitive.Positions, VertexIndexStart, FVector::ZeroVector, bMissingIgnore));
-						FLinearColor Color;
-						// Lines and Points are not handled by UStaticMesh, therefore local2world transforms
-						// applied manually.
-						Position = MeshTransform.TransformPosition(Position);
+						// points are kept in local space, the niagara system is attached to the mesh component
+						if (!bIdentityIndices)
+						{
+							IndexedPositions[PointIndex] = GetSafeValue(Primitive.Positions, VertexIndexStart, FVector::ZeroVector, bMissingIgnore);
+						}
 
-						if (!Primitive.Colors.IsEmpty())
+						for (const TPair<const TArray<float>*, float*>& AttributeData : AttributesData)
 						{
-							Color = FLinearColor(Primitive.Colors[PointIndex]).ToFColor(true);
+							AttributeData.Value[PointIndex] = GetSafeValue(*AttributeData.Key, VertexIndexStart, 0.0f, bMissingIgnore);
+						}
 
-							//// Colours are appearing too bright. Should they be squared, cubed?
-							//Colors[PointIndex].R *= Colors[PointIndex].R * Colors[PointIndex].R;
-							//Colors[PointIndex].G *= Colors[PointIndex].G * Colors[PointIndex].G;
-							//Colors[PointIndex].B *= Colors[PointIndex].B * Colors[PointIndex].B;
+						// colors are stored as plain (linear) BGRA bytes, indexed like the positions
+						if (Primitive.Colors.IsValidIndex(VertexIndexStart))
+						{
+							Colors[PointIndex] = FLinearColor(Primitive.Colors[VertexIndexStart]).ToFColor(false);
 						}
+					}
 
-						Positions[4 * PointIndex] = Position.X;
-						Positions[4 * PointIndex + 1] = Position.Y;
-						Positions[4 * PointIndex + 2] = Position.Z;
+					// Split the cloud in chunks, only the chunks required by the current view are uploaded to the GPU.
+					// (in sprites mode the whole cloud is a single chunk)
+					TSharedRef<FglTFRuntimePointCloudOctree> Octree = MakeShared<FglTFRuntimePointCloudOctree>();
+					const int32 MaxPointsPerChunk = PointCloudMode == EglTFRuntimePointCloudMode::Streaming ? PointCloudConfig.MaxPointsPerChunk : NumVertexInstancesPerSection;
+					Octree->Build(bIdentityIndices ? Primitive.Positions : IndexedPositions, Colors, Attributes, MaxPointsPerChunk, PointCloudConfig.MaxOctreeDepth, PointCloudConfig.bQuantizedPositions);
 
-						Colors[4 * PointIndex] = Color.B * 255;
-						Colors[4 * PointIndex + 1] = Color.G * 255;
-						Colors[4 * PointIndex + 2] = Color.R * 255;
-						Colors[4 * PointIndex + 3] = Color.A * 255;
+					// an updated cloud keeps its niagara system (and its textures when big enough)
+					UglTFRuntimePointCloudComponent* PointCloudComponent = GetOrCreateHelperComponent<UglTFRuntimePointCloudComponent>(StaticMeshComponent, TEXT("PointCloud"));
+					UNiagaraComponent* PointCloud = PointCloudComponent->GetNiagaraComponent();
+					if (!PointCloud)
+					{
+						PointCloud = UNiagaraFunctionLibrary::SpawnSystemAttached(
+							NS, StaticMeshComponent, NAME_None, FVector::Zero(), FRotator(0, 0, 0), EAttachLocation::KeepRelativeOffset, true, true, ENCPoolMethod::AutoRelease, true);
+					}
+					else if (PointCloud->GetAsset() != NS)
+					{
+						PointCloud->SetAsset(NS);
 					}
 
-					UNiagaraComponent* PointCloud = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-						StaticMeshComponent->GetWorld(), NS, FVector::Zero(), FRotator(0, 0, 0), FVector::One(), true, true, ENCPoolMethod::AutoRelease, true);
-
-					InjectPointcloudData(PointCloud, Positions, Colors, NumVertexInstancesPerSection);
+					PointCloudComponent->PointBudget = PointCloudConfig.PointBudget;
+					PointCloudComponent->MinChunkScreenSize = PointCloudConfig.MinChunkScreenSize;
+					PointCloudComponent->bFrustumCulling = PointCloudConfig.bFrustumCulling;
+					PointCloudComponent->CullChunkScreenSize = PointCloudConfig.CullChunkScreenSize;
+					PointCloudComponent->bQuantizedPositions = PointCloudConfig.bQuantizedPositions;
+					PointCloudComponent->SetPointCloud(Octree, PointCloud);
+					if (!PointCloudComponent->IsRegistered())
+					{
+						PointCloudComponent->SetupAttachment(StaticMeshComponent);
+						if (StaticMeshComponent->GetWorld())
+						{
+							PointCloudComponent->RegisterComponentWithWorld(StaticMeshComponent->GetWorld());
+						}
+					}
 
 					return nullptr;
 					
@@ -427,7 +451,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 			if (Primitive.Mode == MODE_TRIANGLES) {
 				Section.NumTriangles = NumVertexInstancesPerSection / 3;
-				Section.FirstIndex = VertexInstanceBaseIndex;
+				Section.FirstIndex = IndexBaseIndex;
 				Section.bEnableCollision = true;
 				Section.bCastShadow = true;
 
@@ -439,9 +463,13 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 				const int32 SectionIndex = Sections.Num() - 1;
 
 				int32 MaterialIndex = 0;
-				if (Primitive.bHasMaterial || !SectionMaterialMap.Contains(SectionIndex))
+				if (Primitive.bHasMaterial || (Primitive.bMaterialPending && Primitive.MaterialIndex != INDEX_NONE) || !SectionMaterialMap.Contains(SectionIndex))
 				{
 					MaterialIndex = StaticMeshContext->StaticMaterials.Add(StaticMaterial);
+					if (Primitive.bMaterialPending)
+					{
+						StaticMeshContext->PendingStaticMaterials.Add(MaterialIndex, &Primitive);
+					}
 					if (!SectionMaterialMap.Contains(SectionIndex))
 					{
 						SectionMaterialMap.Add(SectionIndex, MaterialIndex);
@@ -465,15 +493,56 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 				SectionInfoMap.Set(CurrentLODIndex, SectionIndex, MeshSectionInfo);
 #endif
 
+				const bool bCanGenerateNormals = (Primitive.Normals.Num() < Primitive.Positions.Num() && StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::IfMissing) ||
+					StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always;
+
+				// flat normals require a vertex per triangle corner, otherwise we keep the glTF topology
+				// (only the vertices referenced by the primitive are added to the vertex buffer)
+				bool bIndexed = !bCanGenerateNormals || (NumVertexInstancesPerSection % 3) != 0;
+
+				TArray<int32> VertexRemap;
+				TArray<uint32> UniqueVertices;
+				if (bIndexed)
+				{
+					VertexRemap.Init(INDEX_NONE, Primitive.Positions.Num());
+					for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex++)
+					{
+						const uint32 VertexIndex = Primitive.Indices[VertexInstanceSectionIndex];
+						// out of bounds indices are managed by the de-indexed path (GetSafeValue will fill them with defaults)
+						if (VertexIndex >= static_cast<uint32>(Primitive.Positions.Num()))
+						{
+							bIndexed = false;
+							break;
+						}
+						int32& RemappedIndex = VertexRemap[VertexIndex];
+						if (RemappedIndex == INDEX_NONE)
+						{
+							RemappedIndex = UniqueVertices.Add(VertexIndex);
+						}
+					}
+				}
+
+				const TArray<uint32>& SectionVertices = bIndexed ? UniqueVertices : Primitive.Indices;
+				const int32 NumVerticesPerSection = SectionVertices.Num();
+
+				Section.MinVertexIndex = VertexBaseIndex;
+				Section.MaxVertexIndex = VertexBaseIndex + FMath::Max(NumVerticesPerSection - 1, 0);
+
+				StaticMeshBuildVertices.AddDefaulted(NumVerticesPerSection);
 				LODIndices.AddUninitialized(NumVertexInstancesPerSection);
 
-				// Geometry generation
 				for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex++)
 				{
-					uint32 VertexIndex = Primitive.Indices[VertexInstanceSectionIndex];
-					LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex] = VertexInstanceBaseIndex + VertexInstanceSectionIndex;
+					const int32 SectionVertexIndex = bIndexed ? VertexRemap[Primitive.Indices[VertexInstanceSectionIndex]] : VertexInstanceSectionIndex;
+					LODIndices[IndexBaseIndex + VertexInstanceSectionIndex] = VertexBaseIndex + SectionVertexIndex;
+				}
+
+				// Geometry generation
+				for (int32 VertexSectionIndex = 0; VertexSectionIndex < NumVerticesPerSection; VertexSectionIndex++)
+				{
+					uint32 VertexIndex = SectionVertices[VertexSectionIndex];
 
-					FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex];
+					FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexBaseIndex + VertexSectionIndex];
 
 #if ENGINE_MAJOR_VERSION > 4
 					StaticMeshVertex.Position = FVector3f(GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore));
@@ -518,7 +587,6 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 					if (bApplyAdditionalTransforms)
 					{
-						UE_LOG(LogTemp, Log, TEXT("Additional transforms wanted for triangles."));
 #if ENGINE_MAJOR_VERSION > 4
 						StaticMeshVertex.Position = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformPosition(FVector3d(StaticMeshVertex.Position)));
 						StaticMeshVertex.TangentX = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentX)));
@@ -542,27 +610,22 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 				AdditionalTransformsPrimitiveIndex++;
 
+				// winding is reversed in the index buffer, so both the indexed and the de-indexed vertices are preserved
 				if (StaticMeshConfig.bReverseWinding && (NumVertexInstancesPerSection % 3) == 0)
 				{
 					for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex += 3)
 					{
-						FStaticMeshBuildVertex StaticMeshVertex1 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1];
-						FStaticMeshBuildVertex StaticMeshVertex2 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2];
-
-						StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1] = StaticMeshVertex2;
-						StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2] = StaticMeshVertex1;
+						Swap(LODIndices[IndexBaseIndex + VertexInstanceSectionIndex + 1], LODIndices[IndexBaseIndex + VertexInstanceSectionIndex + 2]);
 					}
 				}
 
-				const bool bCanGenerateNormals = (bMissingNormals && StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::IfMissing) ||
-					StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always;
-				if (bCanGenerateNormals && (NumVertexInstancesPerSection % 3) == 0)
+				if (bCanGenerateNormals && !bIndexed)
 				{
 					for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex += 3)
 					{
-						FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex];
-						FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1];
-						FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2];
+						FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[LODIndices[IndexBaseIndex + VertexInstanceSectionIndex]];
+						FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[LODIndices[IndexBaseIndex + VertexInstanceSectionIndex + 1]];
+						FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[LODIndices[IndexBaseIndex + VertexInstanceSectionIndex + 2]];
 
 #if ENGINE_MAJOR_VERSION > 4
 						FVector SideA = FVector(StaticMeshVertex1.Position - StaticMeshVertex0.Position);
@@ -590,94 +653,88 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 				const bool bCanGenerateTangents = (bMissingTangents && StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::IfMissing) ||
 					StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Always;
 				// recompute tangents if required (need normals and uvs)
+				// triangle tangents are accumulated on shared vertices (on de-indexed primitives this is a plain assignment)
 				if (bCanGenerateTangents && !bMissingNormals && Primitive.UVs.Num() > 0 && (NumVertexInstancesPerSection % 3) == 0)
 				{
+					TArray<FVector> TangentsAccumulator;
+					TangentsAccumulator.AddZeroed(NumVerticesPerSection);
+
 					for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex += 3)
 					{
-						FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex];
-						FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1];
-						FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2];
+						const int32 SectionVertexIndex0 = LODIndices[IndexBaseIndex + VertexInstanceSectionIndex] - VertexBaseIndex;
+						const int32 SectionVertexIndex1 = LODIndices[IndexBaseIndex + VertexInstanceSectionIndex + 1] - VertexBaseIndex;
+						const int32 SectionVertexIndex2 = LODIndices[IndexBaseIndex + VertexInstanceSectionIndex + 2] - VertexBaseIndex;
 
+						const FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[VertexBaseIndex + SectionVertexIndex0];
+						const FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[VertexBaseIndex + SectionVertexIndex1];
+						const FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[VertexBaseIndex + SectionVertexIndex2];
 
 #if ENGINE_MAJOR_VERSION > 4
 						FVector Position0 = FVector(StaticMeshVertex0.Position);
-						FVector4 TangentZ0 = FVector(StaticMeshVertex0.TangentZ);
 						FVector2D UV0 = FVector2D(StaticMeshVertex0.UVs[0]);
-#else
-						FVector Position0 = StaticMeshVertex0.Position;
-						FVector4 TangentZ0 = StaticMeshVertex0.TangentZ;
-						FVector2D UV0 = StaticMeshVertex0.UVs[0];
-#endif
-
-
-
-#if ENGINE_MAJOR_VERSION > 4
 						FVector Position1 = FVector(StaticMeshVertex1.Position);
-						FVector4 TangentZ1 = FVector(StaticMeshVertex1.TangentZ);
 						FVector2D UV1 = FVector2D(StaticMeshVertex1.UVs[0]);
-#else
-						FVector Position1 = StaticMeshVertex1.Position;
-						FVector4 TangentZ1 = StaticMeshVertex1.TangentZ;
-						FVector2D UV1 = StaticMeshVertex1.UVs[0];
-#endif
-
-
-
-#if ENGINE_MAJOR_VERSION > 4
 						FVector Position2 = FVector(StaticMeshVertex2.Position);
-						FVector4 TangentZ2 = FVector(StaticMeshVertex2.TangentZ);
 						FVector2D UV2 = FVector2D(StaticMeshVertex2.UVs[0]);
 #else
+						FVector Position0 = StaticMeshVertex0.Position;
+						FVector2D UV0 = StaticMeshVertex0.UVs[0];
+						FVector Position1 = StaticMeshVertex1.Position;
+						FVector2D UV1 = StaticMeshVertex1.UVs[0];
 						FVector Position2 = StaticMeshVertex2.Position;
-						FVector4 TangentZ2 = StaticMeshVertex2.TangentZ;
 						FVector2D UV2 = StaticMeshVertex2.UVs[0];
 #endif
 
-
 						FVector DeltaPosition0 = Position1 - Position0;
 						FVector DeltaPosition1 = Position2 - Position0;
 
 						FVector2D DeltaUV0 = UV1 - UV0;
 						FVector2D DeltaUV1 = UV2 - UV0;
 
-						float Factor = 1.0f / (DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X);
+						const float Determinant = DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X;
+						// skip degenerate uv triangles (they would poison shared vertices)
+						if (FMath::IsNearlyZero(Determinant))
+						{
+							continue;
+						}
 
-						FVector TriangleTangentX = ((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor;
-						FVector TriangleTangentY = ((DeltaPosition0 * DeltaUV1.X) - (DeltaPosition1 * DeltaUV0.X)) * Factor;
+						float Factor = 1.0f / Determinant;
 
-						FVector TangentX0 = TriangleTangentX - (TangentZ0 * FVector::DotProduct(TangentZ0, TriangleTangentX));
-						TangentX0.Normalize();
+						FVector TriangleTangentX = (((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor).GetSafeNormal();
 
-						FVector TangentX1 = TriangleTangentX - (TangentZ1 * FVector::DotProduct(TangentZ1, TriangleTangentX));
-						TangentX1.Normalize();
+						TangentsAccumulator[SectionVertexIndex0] += TriangleTangentX;
+						TangentsAccumulator[SectionVertexIndex1] += TriangleTangentX;
+						TangentsAccumulator[SectionVertexIndex2] += TriangleTangentX;
+					}
 
-						FVector TangentX2 = TriangleTangentX - (TangentZ2 * FVector::DotProduct(TangentZ2, TriangleTangentX));
-						TangentX2.Normalize();
+					for (int32 VertexSectionIndex = 0; VertexSectionIndex < NumVerticesPerSection; VertexSectionIndex++)
+					{
+						if (TangentsAccumulator[VertexSectionIndex].IsNearlyZero())
+						{
+							continue;
+						}
 
+						FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexBaseIndex + VertexSectionIndex];
 #if ENGINE_MAJOR_VERSION > 4
-						StaticMeshVertex0.TangentX = FVector3f(TangentX0);
-						StaticMeshVertex0.TangentY = FVector3f(ComputeTangentY(FVector(StaticMeshVertex0.TangentZ), FVector(StaticMeshVertex0.TangentX)) * TangentsDirection);
-
-						StaticMeshVertex1.TangentX = FVector3f(TangentX1);
-						StaticMeshVertex1.TangentY = FVector3f(ComputeTangentY(FVector(StaticMeshVertex1.TangentZ), FVector(StaticMeshVertex1.TangentX)) * TangentsDirection);
-
-						StaticMeshVertex2.TangentX = FVector3f(TangentX2);
-						StaticMeshVertex2.TangentY = FVector3f(ComputeTangentY(FVector(StaticMeshVertex2.TangentZ), FVector(StaticMeshVertex2.TangentX)) * TangentsDirection);
+						const FVector TangentZ = FVector(StaticMeshVertex.TangentZ);
 #else
-						StaticMeshVertex0.TangentX = TangentX0;
-						StaticMeshVertex0.TangentY = ComputeTangentY(StaticMeshVertex0.TangentZ, StaticMeshVertex0.TangentX) * TangentsDirection;
-
-						StaticMeshVertex1.TangentX = TangentX1;
-						StaticMeshVertex1.TangentY = ComputeTangentY(StaticMeshVertex1.TangentZ, StaticMeshVertex1.TangentX) * TangentsDirection;
-
-						StaticMeshVertex2.TangentX = TangentX2;
-						StaticMeshVertex2.TangentY = ComputeTangentY(StaticMeshVertex2.TangentZ, StaticMeshVertex2.TangentX) * TangentsDirection;
+						const FVector TangentZ = StaticMeshVertex.TangentZ;
 #endif
+						FVector TangentX = TangentsAccumulator[VertexSectionIndex] - (TangentZ * FVector::DotProduct(TangentZ, TangentsAccumulator[VertexSectionIndex]));
+						TangentX.Normalize();
 
+#if ENGINE_MAJOR_VERSION > 4
+						StaticMeshVertex.TangentX = FVector3f(TangentX);
+						StaticMeshVertex.TangentY = FVector3f(ComputeTangentY(TangentZ, TangentX) * TangentsDirection);
+#else
+						StaticMeshVertex.TangentX = TangentX;
+						StaticMeshVertex.TangentY = ComputeTangentY(TangentZ, TangentX) * TangentsDirection;
+#endif
 					}
 				}
 
-				VertexInstanceBaseIndex += NumVertexInstancesPerSection;
+				IndexBaseIndex += NumVertexInstancesPerSection;
+				VertexBaseIndex += NumVerticesPerSection;
 			}
 		}
 
@@ -831,109 +888,35 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 	return StaticMesh;
 }
 
-// Implementation of code from Andre Mhlenbrock, 2020
-// See https://www.youtube.com/watch?v=TmG-XIxaLVQ&ab_channel=phirede
-void FglTFRuntimeParser::InjectPointcloudData(UNiagaraComponent* PointCloud, TArray<float>& Positions, TArray<uint8_t>& Colors, const int32 PointCount) {
-	
-	// Find an appropriate texture height and width
-	// (Each edge length a power of 2, approximately square shaped, and as small as possible)
-	float SqrtPointCount = UKismetMathLibrary::Sqrt(PointCount);
-	int32 SqrtNextPow2 = pow(2, ceil(log(SqrtPointCount) / log(2)));
-	int32 TextureWidth = SqrtNextPow2;
-	int32 TextureHeight = (SqrtNextPow2 * SqrtNextPow2 / 2 > PointCount) ? SqrtNextPow2 / 2 : SqrtNextPow2;
-
-	// Pad positions and colors to size of texture in order to prevent raw memory being read/written later.
-	// Initial size is 4 * PointCount
-	// Final size should be 4 * TextureWidth * TextureHeight
-	Positions.AddDefaulted(4 * (TextureWidth * TextureHeight - PointCount));
-	Colors.AddDefaulted(4 * (TextureWidth * TextureHeight - PointCount));
-
-	Region = FUpdateTextureRegion2D(0, 0, 0, 0, TextureWidth, TextureHeight);
-	UE_LOG(LogTemp, Log, TEXT("Region Width: %d"), Region.Width);
-	UE_LOG(LogTemp, Log, TEXT("Region Height: %d"), Region.Height);
-
-	// Create textures
-	PositionTexture = UTexture2D::CreateTransient(TextureWidth, TextureHeight, PF_A32B32G32R32F, "PositionData");
-	PositionTexture->Filter = TF_Nearest;
-	PositionTexture->UpdateResource();
-
-	ColorTexture = UTexture2D::CreateTransient(TextureWidth, TextureHeight, PF_B8G8R8A8, "ColorTexture");
-	ColorTexture->Filter = TF_Nearest;
-	ColorTexture->UpdateResource();
-
-	// Set the niagara system user variables:
-	SetNiagaraVariableTexture(PointCloud, "User.PositionTexture", PositionTexture);
-	SetNiagaraVariableTexture(PointCloud, "User.ColorTexture", ColorTexture);
-
-	PointCloud->SetVariableInt("User.Count", PointCount);
-	PointCloud->SetVariableInt("User.TextureWidth", TextureWidth);
-	PointCloud->SetVariableInt("User.TextureHeight", TextureHeight);
-
-
-	UE_LOG(LogTemp, Log, TEXT("PositionData nominal size: %d"), 4 * PointCount * sizeof(float));
-	UE_LOG(LogTemp, Log, TEXT("ColorData nominal size: %d"), 4 * PointCount * sizeof(uint8_t));
-
-	uint8* TexturePositionData = new uint8[4 * PointCount * sizeof(float)];
-	uint8* TextureColorData = new uint8[4 * PointCount * sizeof(uint8_t)];
-
-	TexturePositionData = (uint8*)Positions.GetData();
-	TextureColorData = (uint8*)Colors.GetData();
-
-	UE_LOG(LogTemp, Log, TEXT("PositionData size: %d"), sizeof(TexturePositionData));
-	UE_LOG(LogTemp, Log, TEXT("ColorData size: %d"), sizeof(TextureColorData));
-
-	UE_LOG(LogTemp, Log, TEXT("PositionData pointing to size: %d"), sizeof(*TexturePositionData));
-	UE_LOG(LogTemp, Log, TEXT("ColorData pointing to size: %d"), sizeof(*TextureColorData));
-
-	// Bring the data into the texture
-	uint32 PositionPixelWidth = 4 * sizeof(float);
-	uint32 PositionPitch = TextureWidth * PositionPixelWidth;
-
-
-	UE_LOG(LogTemp, Log, TEXT("Color Pitch: %d"), PositionPitch);
-	UE_LOG(LogTemp, Log, TEXT("Color Pixel: %d"), PositionPixelWidth);
-	
-	PositionTexture->UpdateTextureRegions(0, 1, &Region, PositionPitch, PositionPixelWidth,
-		TexturePositionData);
-
-	delete [] TexturePositionData;
-
-	uint32 ColorPixelWidth = 4 * sizeof(uint8_t);
-	uint32 ColorPitch = TextureWidth * ColorPixelWidth;
-
-	UE_LOG(LogTemp, Log, TEXT("Color Pitch: %d"), ColorPitch);
-	UE_LOG(LogTemp, Log, TEXT("Color Pixel: %d"), ColorPixelWidth);
-
-	ColorTexture->UpdateTextureRegions(0, 1, &Region, ColorPitch, ColorPixelWidth, TextureColorData);
-
-	delete [] TextureColorData;
-}
-
-
-/**
- * Just a helper method to set a texture for a user variable because the UNiagaraComponent
- * has no direct way to edit a texture variable compared to float, vectors, ...
- */
-void FglTFRuntimeParser::SetNiagaraVariableTexture(UNiagaraComponent* PointCloud, const FString VariableName, UTexture* Texture) {
-	if (!PointCloud || !Texture)
-		return;
-
-	FNiagaraUserRedirectionParameterStore& OverrideParameters = PointCloud->GetOverrideParameters();
-	FNiagaraVariable NiagaraVariable = FNiagaraVariable(FNiagaraTypeDefinition(UNiagaraDataInterfaceTexture::StaticClass()), *VariableName);
-
-	UNiagaraDataInterfaceTexture* DataInterface = (UNiagaraDataInterfaceTexture*)OverrideParameters.GetDataInterface(NiagaraVariable);
-	DataInterface->SetTexture(Texture);
-}
-
-
 UStaticMesh* FglTFRuntimeParser::FinalizeStaticMesh(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FinalizeStaticMesh, FColor::Magenta);
 
+	// glyph meshes are already built assets
+	if (!StaticMeshContext->bFinalizeStaticMesh)
+	{
+		return StaticMeshContext->StaticMesh;
+	}
+
 	UStaticMesh* StaticMesh = StaticMeshContext->StaticMesh;
 	FStaticMeshRenderData* RenderData = StaticMeshContext->RenderData;
 	const FglTFRuntimeStaticMeshConfig& StaticMeshConfig = StaticMeshContext->StaticMeshConfig;
 
+	// primitives decoded on a worker only carry the material index
+	for (const TPair<int32, const FglTFRuntimePrimitive*>& Pair : StaticMeshContext->PendingStaticMaterials)
+	{
+		FString MaterialName;
+		UMaterialInterface* Material = LoadPrimitiveMaterial(Pair.Value->MaterialIndex, Pair.Value->Colors.Num() > 0, StaticMeshConfig.MaterialsConfig, MaterialName);
+		if (!Material)
+		{
+			return nullptr;
+		}
+		FStaticMaterial& StaticMaterial = StaticMeshContext->StaticMaterials[Pair.Key];
+		StaticMaterial.MaterialInterface = Material;
+		StaticMaterial.MaterialSlotName = FName(StaticMaterial.MaterialSlotName.ToString() + MaterialName);
+	}
+	StaticMeshContext->PendingStaticMaterials.Empty();
+
 #if ENGINE_MAJOR_VERSION > 4 || (ENGINE_MINOR_VERSION > 26)
 	StaticMesh->SetStaticMaterials(StaticMeshContext->StaticMaterials);
 #else
@@ -1108,9 +1091,22 @@ bool FglTFRuntimeParser::LoadStaticMeshes(TArray<UStaticMesh*>& StaticMeshes, co
 
 bool FglTFRuntimeParser::LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
 {
-	if (LODsCache.Contains(JsonMeshObject))
+	LOD = nullptr;
 	{
-		LOD = &LODsCache[JsonMeshObject];
+		FReadScopeLock Lock(LODsCacheLock);
+		if (TSharedPtr<FglTFRuntimeMeshLOD>* CachedLOD = LODsCache.Find(JsonMeshObject))
+		{
+			LOD = CachedLOD->Get();
+		}
+	}
+
+	if (LOD)
+	{
+		// the LOD could have been decoded on a worker, its game thread continuation may not have run yet
+		if (IsInGameThread())
+		{
+			return ResolvePendingMaterials(*LOD, MaterialsConfig);
+		}
 		return true;
 	}
 
@@ -1120,11 +1116,17 @@ bool FglTFRuntimeParser::LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObj
 		return false;
 	}
 
-	FglTFRuntimeMeshLOD NewLOD;
-	NewLOD.Primitives = MoveTemp(Primitives);
+	TSharedPtr<FglTFRuntimeMeshLOD> NewLOD = MakeShared<FglTFRuntimeMeshLOD>();
+	NewLOD->Primitives = MoveTemp(Primitives);
 
-	FglTFRuntimeMeshLOD& CachedLOD = LODsCache.Add(JsonMeshObject, MoveTemp(NewLOD));
-	LOD = &CachedLOD;
+	FWriteScopeLock Lock(LODsCacheLock);
+	// keep the first LOD if the same mesh has been loaded concurrently
+	TSharedPtr<FglTFRuntimeMeshLOD>& CachedLOD = LODsCache.FindOrAdd(JsonMeshObject);
+	if (!CachedLOD)
+	{
+		CachedLOD = NewLOD;
+	}
+	LOD = CachedLOD.Get();
 	return true;
 }
 
@@ -1240,13 +1242,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMeshLODs(const TArray<int32>& MeshInd
 
 	if (StaticMesh)
 	{
-		if (bFinalizeStaticMesh) {
-			return FinalizeStaticMesh(StaticMeshContext);
-		}
-		else
-		{
-			return StaticMesh;
-		}
+		return FinalizeStaticMesh(StaticMeshContext);
 	}
 	return nullptr;
 }
@@ -1255,7 +1251,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 {
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndices, AsyncCallback]()
+	RunOnWorkerPool([this, StaticMeshContext, MeshIndices, AsyncCallback]()
 		{
 			bool bSuccess = true;
 			for (const int32 MeshIndex : MeshIndices)
@@ -1283,7 +1279,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 				StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
+			RunOnGameThread([StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
 					{
@@ -1291,8 +1287,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 					}
 
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+				});
 		});
 }
 
@@ -1484,7 +1479,7 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), StaticMeshConfig);
 
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, StaticMeshConfig, ExcludeNodes, NodeName, AsyncCallback]()
+	RunOnWorkerPool([this, StaticMeshContext, StaticMeshConfig, ExcludeNodes, NodeName, AsyncCallback]()
 		{
 
 			FglTFRuntimeNode Node;
@@ -1523,7 +1518,8 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 				}
 			}
 
-			FglTFRuntimeMeshLOD CombinedLOD;
+			// owned by the context as finalization happens after the worker returns
+			FglTFRuntimeMeshLOD& CombinedLOD = StaticMeshContext->AddContextLOD();
 
 			for (FglTFRuntimeNode& ChildNode : Nodes)
 			{
@@ -1570,11 +1566,9 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 				}
 			}
 
-			StaticMeshContext->LODs.Add(&CombinedLOD);
-
 			StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
+			RunOnGameThread([StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
 					{
@@ -1582,8 +1576,7 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 					}
 
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+				});
 		});
 }
 
@@ -1627,16 +1620,16 @@ void FglTFRuntimeParser::LoadStaticMeshFromRuntimeLODsAsync(const TArray<FglTFRu
 {
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, StaticMeshConfig, RuntimeLODs, AsyncCallback]()
+	RunOnWorkerPool([this, StaticMeshContext, StaticMeshConfig, RuntimeLODs, AsyncCallback]()
 		{
 			for (const FglTFRuntimeMeshLOD& RuntimeLOD : RuntimeLODs)
 			{
-				StaticMeshContext->LODs.Add(&RuntimeLOD);
+				StaticMeshContext->AddContextLOD() = RuntimeLOD;
 			}
 
 			StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
+			RunOnGameThread([StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
 					{
@@ -1644,8 +1637,7 @@ void FglTFRuntimeParser::LoadStaticMeshFromRuntimeLODsAsync(const TArray<FglTFRu
 					}
 
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+				});
 		}
 	);
 }
\ No newline at end of file
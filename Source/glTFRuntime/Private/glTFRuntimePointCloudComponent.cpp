@@ -0,0 +1,742 @@
+// Copyright 2023, Roberto De Ioris.
+
+#include "glTFRuntimePointCloudComponent.h"
+#include "glTFRuntimeParser.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "NiagaraComponent.h"
+#include "NiagaraDataInterfaceTexture.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "SceneManagement.h"
+
+DECLARE_STATS_GROUP(TEXT("glTFRuntime"), STATGROUP_glTFRuntime, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Point Cloud Points Resident"), STAT_glTFRuntimePointCloudPointsResident, STATGROUP_glTFRuntime);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Point Cloud Points Uploaded"), STAT_glTFRuntimePointCloudPointsUploaded, STATGROUP_glTFRuntime);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Point Cloud Points Drawn"), STAT_glTFRuntimePointCloudPointsDrawn, STATGROUP_glTFRuntime);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Point Cloud Points Culled"), STAT_glTFRuntimePointCloudPointsCulled, STATGROUP_glTFRuntime);
+
+void FglTFRuntimePointCloudOctree::Build(const TArray<FVector>& InPositions, const TArray<FColor>& InColors, const TMap<FString, TArray<float>>& InAttributes, const int32 MaxPointsPerChunk, const int32 MaxDepth, const bool bQuantizePositions)
+{
+	Positions.Empty();
+	FullPrecisionPositions.Empty();
+	Colors.Empty(InPositions.Num());
+	AttributeNames.Empty();
+	Attributes.Empty();
+	AttributeRanges.Empty();
+	Chunks.Empty();
+
+	if (InPositions.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<const TArray<float>*> AttributesValues;
+	for (const TPair<FString, TArray<float>>& Pair : InAttributes)
+	{
+		AttributeNames.Add(Pair.Key);
+		Attributes.AddDefaulted_GetRef().Reserve(InPositions.Num());
+		AttributesValues.Add(&Pair.Value);
+
+		FVector2f Range(0, 0);
+		if (Pair.Value.Num() > 0)
+		{
+			Range.X = FMath::Min(Pair.Value);
+			Range.Y = FMath::Max(Pair.Value);
+		}
+		AttributeRanges.Add(Range);
+	}
+
+	FBox3f Bounds(ForceInit);
+	for (const FVector& Position : InPositions)
+	{
+		Bounds += FVector3f(Position);
+	}
+
+	// cubic bounds give regular children
+	const FVector3f Center = Bounds.GetCenter();
+	const float HalfSize = FMath::Max(Bounds.GetExtent().GetMax(), KINDA_SMALL_NUMBER);
+	const FBox3f CubeBounds(Center - FVector3f(HalfSize), Center + FVector3f(HalfSize));
+
+	TArray<int32> PointIndices;
+	PointIndices.AddUninitialized(InPositions.Num());
+	for (int32 PointIndex = 0; PointIndex < InPositions.Num(); PointIndex++)
+	{
+		PointIndices[PointIndex] = PointIndex;
+	}
+
+	// a root leaf spans the whole cloud, keep its positions as floats unless quantization has been explicitly requested
+	bFullPrecisionPositions = !bQuantizePositions && (InPositions.Num() <= FMath::Max(MaxPointsPerChunk, 1) || MaxDepth <= 0);
+	if (bFullPrecisionPositions)
+	{
+		FullPrecisionPositions.Reserve(InPositions.Num());
+	}
+	else
+	{
+		Positions.Reserve(InPositions.Num());
+	}
+
+	BuildChunk(InPositions, InColors, AttributesValues, MoveTemp(PointIndices), CubeBounds, 0, FMath::Max(MaxPointsPerChunk, 1), MaxDepth);
+}
+
+int32 FglTFRuntimePointCloudOctree::BuildChunk(const TArray<FVector>& InPositions, const TArray<FColor>& InColors, const TArray<const TArray<float>*>& InAttributes, TArray<int32>&& PointIndices, const FBox3f& Bounds, const int32 Level, const int32 MaxPointsPerChunk, const int32 MaxDepth)
+{
+	// note: Chunks can grow while recursing, so always access it by index
+	const int32 ChunkIndex = Chunks.AddDefaulted();
+	Chunks[ChunkIndex].Bounds = Bounds;
+	Chunks[ChunkIndex].Level = Level;
+
+	if (PointIndices.Num() <= MaxPointsPerChunk || Level >= MaxDepth)
+	{
+		AddPoints(ChunkIndex, InPositions, InColors, InAttributes, PointIndices, 1);
+		return ChunkIndex;
+	}
+
+	// inner chunks keep an evenly decimated copy of their whole subtree
+	AddPoints(ChunkIndex, InPositions, InColors, InAttributes, PointIndices, FMath::DivideAndRoundUp(PointIndices.Num(), MaxPointsPerChunk));
+
+	const FVector3f Center = Bounds.GetCenter();
+	TArray<int32> OctantsPointIndices[8];
+	for (const int32 PointIndex : PointIndices)
+	{
+		const FVector3f Position = FVector3f(InPositions[PointIndex]);
+		const int32 Octant = (Position.X > Center.X ? 1 : 0) | (Position.Y > Center.Y ? 2 : 0) | (Position.Z > Center.Z ? 4 : 0);
+		OctantsPointIndices[Octant].Add(PointIndex);
+	}
+
+	// release memory before going deeper
+	PointIndices.Empty();
+
+	for (int32 Octant = 0; Octant < 8; Octant++)
+	{
+		if (OctantsPointIndices[Octant].Num() == 0)
+		{
+			continue;
+		}
+
+		FBox3f OctantBounds = Bounds;
+		(Octant & 1 ? OctantBounds.Min.X : OctantBounds.Max.X) = Center.X;
+		(Octant & 2 ? OctantBounds.Min.Y : OctantBounds.Max.Y) = Center.Y;
+		(Octant & 4 ? OctantBounds.Min.Z : OctantBounds.Max.Z) = Center.Z;
+
+		const int32 ChildIndex = BuildChunk(InPositions, InColors, InAttributes, MoveTemp(OctantsPointIndices[Octant]), OctantBounds, Level + 1, MaxPointsPerChunk, MaxDepth);
+		Chunks[ChunkIndex].Children.Add(ChildIndex);
+	}
+
+	return ChunkIndex;
+}
+
+void FglTFRuntimePointCloudOctree::AddPoints(const int32 ChunkIndex, const TArray<FVector>& InPositions, const TArray<FColor>& InColors, const TArray<const TArray<float>*>& InAttributes, const TArray<int32>& PointIndices, const int32 Stride)
+{
+	FglTFRuntimePointCloudChunk& Chunk = Chunks[ChunkIndex];
+	Chunk.FirstPoint = GetNumPoints();
+
+	// quantize in double precision, big (georeferenced) coordinates would lose bits going through floats first
+	const FVector BoundsMin = FVector(Chunk.Bounds.Min);
+	const FVector QuantizeScale = FVector(65535.0) / FVector(Chunk.Bounds.Max - Chunk.Bounds.Min).ComponentMax(FVector(KINDA_SMALL_NUMBER));
+
+	for (int32 Index = 0; Index < PointIndices.Num(); Index += Stride)
+	{
+		const int32 PointIndex = PointIndices[Index];
+		if (bFullPrecisionPositions)
+		{
+			FullPrecisionPositions.Add(FVector3f(InPositions[PointIndex]));
+		}
+		else
+		{
+			const FVector QuantizedPosition = (InPositions[PointIndex] - BoundsMin) * QuantizeScale;
+			FglTFRuntimePointCloudQuantizedPosition& Position = Positions.AddDefaulted_GetRef();
+			Position.X = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(QuantizedPosition.X), 0, 65535));
+			Position.Y = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(QuantizedPosition.Y), 0, 65535));
+			Position.Z = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(QuantizedPosition.Z), 0, 65535));
+		}
+		Colors.Add(InColors.IsValidIndex(PointIndex) ? InColors[PointIndex] : FColor::White);
+		for (int32 AttributeIndex = 0; AttributeIndex < InAttributes.Num(); AttributeIndex++)
+		{
+			Attributes[AttributeIndex].Add(InAttributes[AttributeIndex]->IsValidIndex(PointIndex) ? (*InAttributes[AttributeIndex])[PointIndex] : 0.0f);
+		}
+	}
+
+	Chunk.NumPoints = GetNumPoints() - Chunk.FirstPoint;
+}
+
+FVector3f FglTFRuntimePointCloudOctree::GetPosition(const FglTFRuntimePointCloudChunk& Chunk, const int32 ChunkPointIndex) const
+{
+	if (bFullPrecisionPositions)
+	{
+		return FullPrecisionPositions[Chunk.FirstPoint + ChunkPointIndex];
+	}
+
+	const FglTFRuntimePointCloudQuantizedPosition& Position = Positions[Chunk.FirstPoint + ChunkPointIndex];
+	return Chunk.Bounds.Min + FVector3f(Position.X, Position.Y, Position.Z) * (Chunk.Bounds.Max - Chunk.Bounds.Min) / 65535.0f;
+}
+
+UglTFRuntimePointCloudComponent::UglTFRuntimePointCloudComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+
+	PointBudget = 1000000;
+	MinChunkScreenSize = 0.01f;
+	bFrustumCulling = true;
+	CullChunkScreenSize = 0;
+	bQuantizedPositions = false;
+	NiagaraComponent = nullptr;
+	PositionTexture = nullptr;
+	ColorTexture = nullptr;
+	ChunkBoundsTexture = nullptr;
+	TextureWidth = 0;
+	TextureHeight = 0;
+	NumVisiblePoints = 0;
+	NumCulledPoints = 0;
+	NumUploadedPoints = 0;
+}
+
+void UglTFRuntimePointCloudComponent::BeginDestroy()
+{
+	if (Octree)
+	{
+		DEC_DWORD_STAT_BY(STAT_glTFRuntimePointCloudPointsResident, Octree->GetNumPoints());
+		Octree.Reset();
+	}
+
+	Super::BeginDestroy();
+}
+
+void UglTFRuntimePointCloudComponent::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	// the niagara system is pooled, deactivating it gives it back to the pool
+	if (NiagaraComponent)
+	{
+		NiagaraComponent->DeactivateImmediate();
+		NiagaraComponent = nullptr;
+	}
+
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+}
+
+void UglTFRuntimePointCloudComponent::SetPointCloud(TSharedRef<FglTFRuntimePointCloudOctree> InOctree, UNiagaraComponent* InNiagaraComponent)
+{
+	if (Octree)
+	{
+		DEC_DWORD_STAT_BY(STAT_glTFRuntimePointCloudPointsResident, Octree->GetNumPoints());
+	}
+	INC_DWORD_STAT_BY(STAT_glTFRuntimePointCloudPointsResident, InOctree->GetNumPoints());
+
+	Octree = InOctree;
+	// a new niagara component needs its texture variables to be set again
+	if (NiagaraComponent != InNiagaraComponent)
+	{
+		PositionTexture = nullptr;
+		ColorTexture = nullptr;
+		AttributeTextures.Empty();
+	}
+	NiagaraComponent = InNiagaraComponent;
+	// chunk bounds are specific to the octree
+	ChunkBoundsTexture = nullptr;
+	SelectedChunks.Empty();
+	// textures (when big enough) are reused, but the content of the new cloud must be fully uploaded
+	UploadedChunks.Empty();
+
+	// show the root chunk until the first view is available
+	if (Octree->Chunks.Num() > 0)
+	{
+		SelectedChunks.Add(0);
+		UploadChunks(SelectedChunks);
+	}
+}
+
+TArray<FString> UglTFRuntimePointCloudComponent::GetAttributeNames() const
+{
+	if (!Octree)
+	{
+		return {};
+	}
+	return Octree->AttributeNames;
+}
+
+bool UglTFRuntimePointCloudComponent::GetAttributeChannel(const FString& AttributeName, int32& TextureIndex, int32& Channel, FVector2D& Range) const
+{
+	if (!Octree)
+	{
+		return false;
+	}
+
+	const int32 AttributeIndex = Octree->AttributeNames.IndexOfByKey(AttributeName);
+	if (AttributeIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	TextureIndex = AttributeIndex / 4;
+	Channel = AttributeIndex % 4;
+	Range = FVector2D(Octree->AttributeRanges[AttributeIndex]);
+	return true;
+}
+
+void UglTFRuntimePointCloudComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	UWorld* World = GetWorld();
+	if (!Octree || !NiagaraComponent || !World || World->ViewLocationsRenderedLastFrame.Num() == 0)
+	{
+		return;
+	}
+
+	// the frustum is only available for player views (ViewLocationsRenderedLastFrame has no orientation)
+	FConvexVolume Frustum;
+	bool bHasFrustum = false;
+	if (bFrustumCulling)
+	{
+		APlayerController* PlayerController = World->GetFirstPlayerController();
+		if (PlayerController && PlayerController->PlayerCameraManager)
+		{
+			FMinimalViewInfo ViewInfo = PlayerController->PlayerCameraManager->GetCameraCacheView();
+			// a slightly bigger field of view hides chunks popping at the borders
+			ViewInfo.FOV = FMath::Min(ViewInfo.FOV * 1.1f, 170.0f);
+			FMatrix ViewMatrix;
+			FMatrix ProjectionMatrix;
+			FMatrix ViewProjectionMatrix;
+			UGameplayStatics::GetViewProjectionMatrix(ViewInfo, ViewMatrix, ProjectionMatrix, ViewProjectionMatrix);
+			GetViewFrustumBounds(Frustum, ViewProjectionMatrix, false);
+			bHasFrustum = true;
+		}
+	}
+
+	TArray<int32> NewSelectedChunks;
+	// the octree is in local space (the niagara system is attached to the same parent)
+	SelectChunks(GetComponentTransform().InverseTransformPosition(World->ViewLocationsRenderedLastFrame[0]), bHasFrustum ? &Frustum : nullptr, NewSelectedChunks, NumCulledPoints);
+
+	INC_DWORD_STAT_BY(STAT_glTFRuntimePointCloudPointsCulled, NumCulledPoints);
+
+	// upload only when the view requires different chunks
+	if (NewSelectedChunks != SelectedChunks)
+	{
+		SelectedChunks = MoveTemp(NewSelectedChunks);
+		UploadChunks(SelectedChunks);
+	}
+
+	INC_DWORD_STAT_BY(STAT_glTFRuntimePointCloudPointsDrawn, NumVisiblePoints);
+}
+
+void UglTFRuntimePointCloudComponent::SelectChunks(const FVector& ViewLocation, const FConvexVolume* Frustum, TArray<int32>& OutChunks, int32& OutNumCulledPoints) const
+{
+	OutChunks.Reset();
+	OutNumCulledPoints = 0;
+
+	if (Octree->Chunks.Num() == 0)
+	{
+		return;
+	}
+
+	struct FCandidate
+	{
+		int32 ChunkIndex;
+		float Priority;
+	};
+
+	auto GetPriority = [this, &ViewLocation](const int32 ChunkIndex)
+	{
+		const FBox Bounds = FBox(Octree->Chunks[ChunkIndex].Bounds);
+		const double Radius = Bounds.GetExtent().Size();
+		const double Distance = FMath::Max(FVector::Distance(Bounds.GetCenter(), ViewLocation) - Radius, 1.0);
+		return static_cast<float>(Radius / Distance);
+	};
+
+	auto HighestPriority = [](const FCandidate& A, const FCandidate& B)
+	{
+		return A.Priority > B.Priority;
+	};
+
+	const FTransform& LocalToWorld = GetComponentTransform();
+	auto IsCulled = [this, Frustum, &LocalToWorld](const int32 ChunkIndex, const float Priority)
+	{
+		if (Priority < CullChunkScreenSize)
+		{
+			return true;
+		}
+
+		if (Frustum)
+		{
+			const FBox WorldBounds = FBox(Octree->Chunks[ChunkIndex].Bounds).TransformBy(LocalToWorld);
+			return !Frustum->IntersectBox(WorldBounds.GetCenter(), WorldBounds.GetExtent());
+		}
+
+		return false;
+	};
+
+	const float RootPriority = GetPriority(0);
+	if (IsCulled(0, RootPriority))
+	{
+		OutNumCulledPoints = Octree->Chunks[0].NumPoints;
+		return;
+	}
+
+	// refine the biggest (on screen) chunks first, until the budget is exhausted
+	TArray<FCandidate> Candidates;
+	Candidates.HeapPush({ 0, RootPriority }, HighestPriority);
+	int32 NumPoints = Octree->Chunks[0].NumPoints;
+
+	TArray<FCandidate> VisibleChildren;
+
+	while (Candidates.Num() > 0)
+	{
+		FCandidate Candidate;
+		Candidates.HeapPop(Candidate, HighestPriority, false);
+
+		const FglTFRuntimePointCloudChunk& Chunk = Octree->Chunks[Candidate.ChunkIndex];
+
+		bool bRefine = Chunk.Children.Num() > 0 && Candidate.Priority >= MinChunkScreenSize;
+		int32 RefineCost = 0;
+		int32 NumChildrenCulledPoints = 0;
+		VisibleChildren.Reset();
+		if (bRefine)
+		{
+			// culled children are simply not replacing their parent
+			for (const int32 ChildIndex : Chunk.Children)
+			{
+				const float ChildPriority = GetPriority(ChildIndex);
+				if (IsCulled(ChildIndex, ChildPriority))
+				{
+					NumChildrenCulledPoints += Octree->Chunks[ChildIndex].NumPoints;
+					continue;
+				}
+				VisibleChildren.Add({ ChildIndex, ChildPriority });
+				RefineCost += Octree->Chunks[ChildIndex].NumPoints;
+			}
+			RefineCost -= Chunk.NumPoints;
+			bRefine = NumPoints + RefineCost <= PointBudget;
+		}
+
+		if (!bRefine)
+		{
+			OutChunks.Add(Candidate.ChunkIndex);
+			continue;
+		}
+
+		NumPoints += RefineCost;
+		OutNumCulledPoints += NumChildrenCulledPoints;
+		for (const FCandidate& Child : VisibleChildren)
+		{
+			Candidates.HeapPush(Child, HighestPriority);
+		}
+	}
+
+	OutChunks.Sort();
+}
+
+static UNiagaraDataInterfaceTexture* GetNiagaraVariableTexture(UNiagaraComponent* PointCloud, const FString& VariableName)
+{
+	FNiagaraUserRedirectionParameterStore& OverrideParameters = PointCloud->GetOverrideParameters();
+	FNiagaraVariable NiagaraVariable = FNiagaraVariable(FNiagaraTypeDefinition(UNiagaraDataInterfaceTexture::StaticClass()), *VariableName);
+
+	return Cast<UNiagaraDataInterfaceTexture>(OverrideParameters.GetDataInterface(NiagaraVariable));
+}
+
+static void SetNiagaraVariableTexture(UNiagaraComponent* PointCloud, const FString& VariableName, UTexture* Texture)
+{
+	if (!PointCloud || !Texture)
+	{
+		return;
+	}
+
+	UNiagaraDataInterfaceTexture* DataInterface = GetNiagaraVariableTexture(PointCloud, VariableName);
+	if (DataInterface)
+	{
+		DataInterface->SetTexture(Texture);
+	}
+	else
+	{
+		// the data would never reach the GPU (see FglTFRuntimePointCloudConfig::NiagaraSystem)
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Niagara System %s does not expose the %s texture parameter"), *GetNameSafe(PointCloud->GetAsset()), *VariableName);
+	}
+}
+
+// staging buffers are handed to the render thread and come back here once the upload is done
+struct FglTFRuntimePointCloudStagingPool
+{
+	// only keep a few buffers around, uploads are one per texture per selection change
+	static constexpr int32 MaxFreeBuffers = 8;
+
+	TArray<uint8> Acquire(const int32 Size)
+	{
+		TArray<uint8> Buffer;
+		{
+			FScopeLock Lock(&FreeBuffersLock);
+			for (int32 BufferIndex = 0; BufferIndex < FreeBuffers.Num(); BufferIndex++)
+			{
+				if (FreeBuffers[BufferIndex].Max() >= Size)
+				{
+					Buffer = MoveTemp(FreeBuffers[BufferIndex]);
+					FreeBuffers.RemoveAtSwap(BufferIndex, 1, false);
+					break;
+				}
+			}
+		}
+		Buffer.SetNumUninitialized(Size, false);
+		return Buffer;
+	}
+
+	void Release(TArray<uint8>&& Buffer)
+	{
+		FScopeLock Lock(&FreeBuffersLock);
+		if (FreeBuffers.Num() < MaxFreeBuffers)
+		{
+			FreeBuffers.Add(MoveTemp(Buffer));
+		}
+	}
+
+protected:
+	FCriticalSection FreeBuffersLock;
+	TArray<TArray<uint8>> FreeBuffers;
+};
+
+// Implementation of code from Andre Mühlenbrock, 2020
+// See https://www.youtube.com/watch?v=TmG-XIxaLVQ&ab_channel=phirede
+void UglTFRuntimePointCloudComponent::UploadChunks(const TArray<int32>& Chunks)
+{
+	int32 PointCount = 0;
+	for (const int32 ChunkIndex : Chunks)
+	{
+		PointCount += Octree->Chunks[ChunkIndex].NumPoints;
+	}
+
+	const int32 PreviousPointCount = NumVisiblePoints;
+	NumVisiblePoints = PointCount;
+
+	if (!NiagaraComponent)
+	{
+		return;
+	}
+
+	if (!StagingPool)
+	{
+		StagingPool = MakeShared<FglTFRuntimePointCloudStagingPool, ESPMode::ThreadSafe>();
+	}
+
+	// the chunk index is stored in the 16 bit alpha channel, and only systems exposing the chunk bounds can dequantize
+	const bool bSystemDequantizes = GetNiagaraVariableTexture(NiagaraComponent, "User.ChunkBoundsTexture") != nullptr;
+	const bool bUploadQuantizedPositions = bQuantizedPositions && bSystemDequantizes && Octree->Chunks.Num() <= 65536;
+	const EPixelFormat PositionFormat = bUploadQuantizedPositions ? PF_R16G16B16A16_UNORM : PF_A32B32G32R32F;
+	const int32 PositionBytesPerTexel = bUploadQuantizedPositions ? 4 * sizeof(uint16) : 4 * sizeof(float);
+	const int32 NumAttributes = Octree->Attributes.Num();
+	const int32 NumAttributeTextures = FMath::DivideAndRoundUp(NumAttributes, 4);
+
+	// textures are only recreated when they are too small (extra texels are never read as the particles count is bound to User.Count)
+	bool bFullUpload = false;
+	if (!PositionTexture || !ColorTexture || PositionTexture->GetPixelFormat() != PositionFormat || AttributeTextures.Num() != NumAttributeTextures || TextureWidth * TextureHeight < PointCount)
+	{
+		// Find an appropriate texture height and width
+		// (Each edge length a power of 2, approximately square shaped, and as small as possible)
+		TextureWidth = FMath::RoundUpToPowerOfTwo(FMath::Max(FMath::CeilToInt(FMath::Sqrt(static_cast<float>(PointCount))), 1));
+		TextureHeight = (TextureWidth * TextureWidth / 2 >= PointCount) ? FMath::Max(TextureWidth / 2, 1) : TextureWidth;
+
+		if (bQuantizedPositions && !bSystemDequantizes)
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Niagara System %s does not expose User.ChunkBoundsTexture, uploading float positions"), *GetNameSafe(NiagaraComponent->GetAsset()));
+		}
+
+		PositionTexture = UTexture2D::CreateTransient(TextureWidth, TextureHeight, PositionFormat, "PositionData");
+		PositionTexture->Filter = TF_Nearest;
+		PositionTexture->UpdateResource();
+
+		ColorTexture = UTexture2D::CreateTransient(TextureWidth, TextureHeight, PF_B8G8R8A8, "ColorTexture");
+		ColorTexture->Filter = TF_Nearest;
+		ColorTexture->UpdateResource();
+
+		// Set the niagara system user variables:
+		SetNiagaraVariableTexture(NiagaraComponent, "User.PositionTexture", PositionTexture);
+		SetNiagaraVariableTexture(NiagaraComponent, "User.ColorTexture", ColorTexture);
+
+		AttributeTextures.Empty(NumAttributeTextures);
+		for (int32 AttributeTextureIndex = 0; AttributeTextureIndex < NumAttributeTextures; AttributeTextureIndex++)
+		{
+			UTexture2D* AttributeTexture = UTexture2D::CreateTransient(TextureWidth, TextureHeight, PF_A32B32G32R32F, *FString::Printf(TEXT("AttributeData%d"), AttributeTextureIndex));
+			AttributeTexture->Filter = TF_Nearest;
+			AttributeTexture->UpdateResource();
+			SetNiagaraVariableTexture(NiagaraComponent, FString::Printf(TEXT("User.AttributeTexture%d"), AttributeTextureIndex), AttributeTexture);
+			AttributeTextures.Add(AttributeTexture);
+		}
+		NiagaraComponent->SetVariableInt("User.AttributeCount", NumAttributes);
+
+		NiagaraComponent->SetVariableInt("User.TextureWidth", TextureWidth);
+		NiagaraComponent->SetVariableInt("User.TextureHeight", TextureHeight);
+
+		bFullUpload = true;
+	}
+
+	// the dequantization ranges change with the cloud, not with the textures
+	if (bUploadQuantizedPositions && !ChunkBoundsTexture)
+	{
+		UploadChunksBounds();
+	}
+
+	// chunks are laid out in order, so everything before the first changed chunk is already on the GPU
+	int32 FirstChangedPoint = 0;
+	if (!bFullUpload)
+	{
+		for (int32 Index = 0; Index < Chunks.Num() && Index < UploadedChunks.Num() && Chunks[Index] == UploadedChunks[Index]; Index++)
+		{
+			FirstChangedPoint += Octree->Chunks[Chunks[Index]].NumPoints;
+		}
+	}
+
+	UploadedChunks = Chunks;
+
+	NumUploadedPoints = 0;
+	if (FirstChangedPoint < PointCount)
+	{
+		const int32 FirstRow = FirstChangedPoint / TextureWidth;
+		const int32 NumRows = FMath::DivideAndRoundUp(PointCount, TextureWidth) - FirstRow;
+		const int32 FirstPoint = FirstRow * TextureWidth;
+		const int32 NumTexels = NumRows * TextureWidth;
+
+		NumUploadedPoints = PointCount - FirstPoint;
+		INC_DWORD_STAT_BY(STAT_glTFRuntimePointCloudPointsUploaded, NumUploadedPoints);
+
+		TArray<uint8> PositionStaging = StagingPool->Acquire(NumTexels * PositionBytesPerTexel);
+		TArray<uint8> ColorStaging = StagingPool->Acquire(NumTexels * sizeof(FColor));
+
+		float* PositionData = reinterpret_cast<float*>(PositionStaging.GetData());
+		uint16* QuantizedPositionData = reinterpret_cast<uint16*>(PositionStaging.GetData());
+		FColor* ColorData = reinterpret_cast<FColor*>(ColorStaging.GetData());
+
+		TArray<TArray<uint8>> AttributesStaging;
+		for (int32 AttributeTextureIndex = 0; AttributeTextureIndex < NumAttributeTextures; AttributeTextureIndex++)
+		{
+			TArray<uint8>& AttributeStaging = AttributesStaging.Add_GetRef(StagingPool->Acquire(NumTexels * 4 * sizeof(float)));
+			// unused channels of the last texture must not contain garbage
+			if (AttributeTextureIndex == NumAttributeTextures - 1 && NumAttributes % 4 != 0)
+			{
+				FMemory::Memzero(AttributeStaging.GetData(), AttributeStaging.Num());
+			}
+		}
+
+		int32 PointIndex = 0;
+		for (const int32 ChunkIndex : Chunks)
+		{
+			const FglTFRuntimePointCloudChunk& Chunk = Octree->Chunks[ChunkIndex];
+			// skip the chunks that are entirely before the first uploaded row
+			if (PointIndex + Chunk.NumPoints <= FirstPoint)
+			{
+				PointIndex += Chunk.NumPoints;
+				continue;
+			}
+
+			// full precision octrees have a single chunk, quantize it to its bounds now
+			const FVector3f QuantizeScale = FVector3f(65535.0f) / (Chunk.Bounds.Max - Chunk.Bounds.Min).ComponentMax(FVector3f(KINDA_SMALL_NUMBER));
+
+			for (int32 ChunkPointIndex = FMath::Max(FirstPoint - PointIndex, 0); ChunkPointIndex < Chunk.NumPoints; ChunkPointIndex++)
+			{
+				const int32 TexelIndex = PointIndex + ChunkPointIndex - FirstPoint;
+				if (bUploadQuantizedPositions)
+				{
+					if (Octree->bFullPrecisionPositions)
+					{
+						const FVector3f QuantizedPosition = (Octree->FullPrecisionPositions[Chunk.FirstPoint + ChunkPointIndex] - Chunk.Bounds.Min) * QuantizeScale;
+						QuantizedPositionData[TexelIndex * 4] = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(QuantizedPosition.X), 0, 65535));
+						QuantizedPositionData[TexelIndex * 4 + 1] = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(QuantizedPosition.Y), 0, 65535));
+						QuantizedPositionData[TexelIndex * 4 + 2] = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(QuantizedPosition.Z), 0, 65535));
+					}
+					else
+					{
+						// already relative to the chunk bounds
+						const FglTFRuntimePointCloudQuantizedPosition& Position = Octree->Positions[Chunk.FirstPoint + ChunkPointIndex];
+						QuantizedPositionData[TexelIndex * 4] = Position.X;
+						QuantizedPositionData[TexelIndex * 4 + 1] = Position.Y;
+						QuantizedPositionData[TexelIndex * 4 + 2] = Position.Z;
+					}
+					QuantizedPositionData[TexelIndex * 4 + 3] = static_cast<uint16>(ChunkIndex);
+				}
+				else
+				{
+					const FVector3f Position = Octree->GetPosition(Chunk, ChunkPointIndex);
+					PositionData[TexelIndex * 4] = Position.X;
+					PositionData[TexelIndex * 4 + 1] = Position.Y;
+					PositionData[TexelIndex * 4 + 2] = Position.Z;
+					PositionData[TexelIndex * 4 + 3] = 0;
+				}
+				ColorData[TexelIndex] = Octree->Colors[Chunk.FirstPoint + ChunkPointIndex];
+				for (int32 AttributeIndex = 0; AttributeIndex < NumAttributes; AttributeIndex++)
+				{
+					float* AttributeData = reinterpret_cast<float*>(AttributesStaging[AttributeIndex / 4].GetData());
+					AttributeData[TexelIndex * 4 + AttributeIndex % 4] = Octree->Attributes[AttributeIndex][Chunk.FirstPoint + ChunkPointIndex];
+				}
+			}
+			PointIndex += Chunk.NumPoints;
+		}
+
+		// pooled buffers are dirty, zero the padding of the last row
+		const int32 NumPaddingTexels = FirstPoint + NumTexels - PointCount;
+		FMemory::Memzero(PositionStaging.GetData() + (NumTexels - NumPaddingTexels) * PositionBytesPerTexel, NumPaddingTexels * PositionBytesPerTexel);
+		FMemory::Memzero(ColorData + (NumTexels - NumPaddingTexels), NumPaddingTexels * sizeof(FColor));
+
+		UploadRows(PositionTexture, TextureWidth, PositionBytesPerTexel, FirstRow, NumRows, MoveTemp(PositionStaging));
+		UploadRows(ColorTexture, TextureWidth, sizeof(FColor), FirstRow, NumRows, MoveTemp(ColorStaging));
+
+		for (int32 AttributeTextureIndex = 0; AttributeTextureIndex < NumAttributeTextures; AttributeTextureIndex++)
+		{
+			FMemory::Memzero(AttributesStaging[AttributeTextureIndex].GetData() + (NumTexels - NumPaddingTexels) * 4 * sizeof(float), NumPaddingTexels * 4 * sizeof(float));
+			UploadRows(AttributeTextures[AttributeTextureIndex], TextureWidth, 4 * sizeof(float), FirstRow, NumRows, MoveTemp(AttributesStaging[AttributeTextureIndex]));
+		}
+	}
+
+	NiagaraComponent->SetVariableInt("User.Count", PointCount);
+
+	// P_Point_glTFRuntime spawns User.Count particles in a single burst and samples the textures only while spawning,
+	// so the system is restarted whenever texels or the count changed (an inactive system picks them up on activation)
+	if ((NumUploadedPoints > 0 || PointCount != PreviousPointCount) && NiagaraComponent->IsActive())
+	{
+		NiagaraComponent->ResetSystem();
+	}
+}
+
+void UglTFRuntimePointCloudComponent::UploadChunksBounds()
+{
+	// two texels per chunk: min and size
+	const int32 NumTexels = Octree->Chunks.Num() * 2;
+	const int32 Width = FMath::RoundUpToPowerOfTwo(FMath::Max(FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumTexels))), 2));
+	const int32 Height = FMath::DivideAndRoundUp(NumTexels, Width);
+
+	ChunkBoundsTexture = UTexture2D::CreateTransient(Width, Height, PF_A32B32G32R32F, "ChunkBoundsData");
+	ChunkBoundsTexture->Filter = TF_Nearest;
+	ChunkBoundsTexture->UpdateResource();
+
+	TArray<uint8> Staging = StagingPool->Acquire(Width * Height * 4 * sizeof(float));
+	FMemory::Memzero(Staging.GetData(), Staging.Num());
+	float* BoundsData = reinterpret_cast<float*>(Staging.GetData());
+	for (int32 ChunkIndex = 0; ChunkIndex < Octree->Chunks.Num(); ChunkIndex++)
+	{
+		const FBox3f& Bounds = Octree->Chunks[ChunkIndex].Bounds;
+		const FVector3f Size = Bounds.Max - Bounds.Min;
+		BoundsData[ChunkIndex * 8] = Bounds.Min.X;
+		BoundsData[ChunkIndex * 8 + 1] = Bounds.Min.Y;
+		BoundsData[ChunkIndex * 8 + 2] = Bounds.Min.Z;
+		BoundsData[ChunkIndex * 8 + 4] = Size.X;
+		BoundsData[ChunkIndex * 8 + 5] = Size.Y;
+		BoundsData[ChunkIndex * 8 + 6] = Size.Z;
+	}
+
+	UploadRows(ChunkBoundsTexture, Width, 4 * sizeof(float), 0, Height, MoveTemp(Staging));
+
+	SetNiagaraVariableTexture(NiagaraComponent, "User.ChunkBoundsTexture", ChunkBoundsTexture);
+	NiagaraComponent->SetVariableInt("User.ChunkBoundsWidth", Width);
+}
+
+void UglTFRuntimePointCloudComponent::UploadRows(UTexture2D* Texture, const int32 Width, const int32 BytesPerTexel, const int32 FirstRow, const int32 NumRows, TArray<uint8>&& Staging)
+{
+	// both the staging data and the region must survive until the render thread has consumed them
+	TArray<uint8>* StagingData = new TArray<uint8>(MoveTemp(Staging));
+	FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(0, FirstRow, 0, 0, Width, NumRows);
+	TSharedPtr<FglTFRuntimePointCloudStagingPool, ESPMode::ThreadSafe> Pool = StagingPool;
+
+	Texture->UpdateTextureRegions(0, 1, Region, Width * BytesPerTexel, BytesPerTexel, StagingData->GetData(),
+		[Pool, StagingData](uint8* Data, const FUpdateTextureRegion2D* Regions)
+		{
+			Pool->Release(MoveTemp(*StagingData));
+			delete StagingData;
+			delete Regions;
+		});
+}
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+class FQueuedThreadPool;
+
 class FglTFRuntimeModule : public IModuleInterface
 {
 public:
@@ -12,4 +14,7 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+	// bounded pool used by all of the glTFRuntime async entry points (nullptr when the module is not loaded)
+	static FQueuedThreadPool* GetWorkerPool();
 };
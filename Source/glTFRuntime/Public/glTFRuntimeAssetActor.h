@@ -22,6 +22,13 @@ protected:
 
 	virtual void ProcessNode(USceneComponent* NodeParentComponent, const FName SocketName, FglTFRuntimeNode& Node);
 
+	UStaticMesh* LoadNodeStaticMesh(const FglTFRuntimeNode& Node, UStaticMeshComponent*& StaticMeshComponent);
+	void UpdateNode(const FglTFRuntimeNode& Node, USceneComponent* Component, const bool bMeshChanged);
+
+	// components (and their mesh index) generated for each node, used by incremental updates
+	TMap<int32, TWeakObjectPtr<USceneComponent>> NodeComponents;
+	TMap<int32, int32> NodeMeshIndices;
+
 	TMap<USceneComponent*, float>  CurveBasedAnimationsTimeTracker;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
@@ -98,6 +105,10 @@ public:
 
 	virtual void PostUnregisterAllComponents() override;
 
+	// apply a new revision of the asset (json plus the changed aux buffers), only the affected nodes are rebuilt.
+	// Returns false (leaving the asset and the actor untouched) when the hierarchy changed and the actor needs to be respawned.
+	bool UpdateFromString(const FString& JsonData, const TMap<FString, FBinaryData>& ChangedAux);
+
 private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"), Category="glTFRuntime")
 	USceneComponent* AssetRoot;
@@ -7,6 +7,27 @@
 #include "glTFRuntimeAsset.h"
 #include "glTFRuntimeAssetActorAsync.generated.h"
 
+class AglTFRuntimeAssetActorAsync;
+
+// tracks a single in-flight mesh load (dynamic delegates cannot carry the target component)
+UCLASS()
+class GLTFRUNTIME_API UglTFRuntimeAssetActorAsyncMeshRequest : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	UPrimitiveComponent* PrimitiveComponent;
+
+	TWeakObjectPtr<AglTFRuntimeAssetActorAsync> Owner;
+
+	UFUNCTION()
+	void OnStaticMeshLoaded(UStaticMesh* StaticMesh);
+
+	UFUNCTION()
+	void OnSkeletalMeshLoaded(USkeletalMesh* SkeletalMesh);
+};
+
 UCLASS()
 class GLTFRUNTIME_API AglTFRuntimeAssetActorAsync : public AActor
 {
@@ -54,6 +75,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
 	bool bStaticMeshesAsSkeletal;
 
+	// how many meshes can be built at the same time (values < 1 are treated as 1)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
+	int32 MaxConcurrentMeshes;
+
 	virtual void PostUnregisterAllComponents() override;
 
 private:
@@ -62,16 +87,16 @@ private:
 
 	TMap<UPrimitiveComponent*, FglTFRuntimeNode> MeshesToLoad;
 
-	void LoadNextMeshAsync();
+	UPROPERTY()
+	TArray<UglTFRuntimeAssetActorAsyncMeshRequest*> MeshRequestsInFlight;
 
-	UFUNCTION()
-	void LoadStaticMeshAsync(UStaticMesh* StaticMesh);
+	void LoadNextMeshAsync();
 
-	UFUNCTION()
-	void LoadSkeletalMeshAsync(USkeletalMesh* SkeletalMesh);
+	void LoadStaticMeshAsync(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest, UStaticMesh* StaticMesh);
+	void LoadSkeletalMeshAsync(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest, USkeletalMesh* SkeletalMesh);
+	void MeshRequestCompleted(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest);
 
-	// this is safe to share between game and async threads because everything is sequential
-	UPrimitiveComponent* CurrentPrimitiveComponent;
+	friend class UglTFRuntimeAssetActorAsyncMeshRequest;
 
 	double LoadingStartTime;
 
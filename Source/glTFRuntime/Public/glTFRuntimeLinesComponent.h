@@ -0,0 +1,43 @@
+// Copyright 2023, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/PrimitiveComponent.h"
+#include "glTFRuntimeLinesComponent.generated.h"
+
+// a segment in component space, the colors are interpolated along it
+struct FglTFRuntimeLine
+{
+	FVector Start;
+	FVector End;
+	FColor StartColor;
+	FColor EndColor;
+};
+
+/**
+ * Draws a set of lines stored in component space, uploaded once as a static line list and transformed on the GPU.
+ * Lines are rasterized one pixel wide.
+ */
+UCLASS(Blueprintable, meta = (BlueprintSpawnableComponent))
+class GLTFRUNTIME_API UglTFRuntimeLinesComponent : public UPrimitiveComponent
+{
+	GENERATED_BODY()
+
+public:
+	UglTFRuntimeLinesComponent();
+
+	void SetLines(TArray<FglTFRuntimeLine>&& InLines);
+
+	const TArray<FglTFRuntimeLine>& GetLines() const { return Lines; }
+
+	virtual FPrimitiveSceneProxy* CreateSceneProxy() override;
+	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+	virtual void GetUsedMaterials(TArray<UMaterialInterface*>& OutMaterials, bool bGetDebugMaterials = false) const override;
+
+	static UMaterialInterface* GetLinesMaterial();
+
+protected:
+	TArray<FglTFRuntimeLine> Lines;
+	FBox LocalBounds;
+};
@@ -8,6 +8,7 @@
 #include "Animation/AnimEnums.h"
 #include "Animation/Skeleton.h"
 #include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
 #include "Dom/JsonValue.h"
 #include "Dom/JsonObject.h"
 #include "Engine/DataAsset.h"
@@ -18,6 +19,7 @@
 #include "Engine/Texture2DArray.h"
 #include "Engine/TextureCube.h"
 #include "Engine/TextureMipDataProviderFactory.h"
+#include "HAL/ThreadSafeBool.h"
 #include "Camera/CameraComponent.h"
 #include "Components/AudioComponent.h"
 #include "Components/LightComponent.h"
@@ -54,6 +56,16 @@ struct FBinaryData
 	GENERATED_BODY()
 	UPROPERTY()
 	TArray<uint8> data;
+
+	// bytes owned by the producer (e.g. the TCP receiver), when set `data` is ignored
+	// and the parser references them directly instead of copying
+	TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> SharedData;
+
+	FBinaryData() = default;
+	explicit FBinaryData(TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> InSharedData) : SharedData(InSharedData) {}
+
+	const uint8* GetData() const { return SharedData ? SharedData->GetData() : data.GetData(); }
+	int64 Num() const { return SharedData ? SharedData->Num() : data.Num(); }
 };
 
 /*
@@ -73,6 +85,19 @@ struct FglTFRuntimeBlob
 	}
 };
 
+// memory mapped external buffer (the region must be released before the handle)
+struct FglTFRuntimeMappedBuffer
+{
+	TUniquePtr<IMappedFileHandle> Handle;
+	TUniquePtr<IMappedFileRegion> Region;
+
+	~FglTFRuntimeMappedBuffer()
+	{
+		Region.Reset();
+		Handle.Reset();
+	}
+};
+
 UENUM()
 enum class EglTFRuntimeTransformBaseType : uint8
 {
@@ -185,6 +210,12 @@ struct FglTFRuntimeConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bAllowExternalFiles;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bMapExternalFiles;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bParallelPrimitivesDecoding;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FString OverrideBaseDirectory;
 
@@ -219,6 +250,8 @@ struct FglTFRuntimeConfig
 		SceneScale = 100;
 		bSearchContentDir = false;
 		bAllowExternalFiles = true;
+		bMapExternalFiles = true;
+		bParallelPrimitivesDecoding = false;
 		bOverrideBaseDirectoryFromContentDir = false;
 		ArchiveAutoEntryPointExtensions = ".glb .gltf .json .js";
 		RuntimeContextObject = nullptr;
@@ -299,6 +332,50 @@ struct FglTFRuntimeScene
 	}
 };
 
+// what changed between two revisions of the same asset (see FglTFRuntimeParser::UpdateFromString)
+USTRUCT(BlueprintType)
+struct FglTFRuntimeSceneUpdate
+{
+	GENERATED_BODY()
+
+	// nodes whose own json changed (transform, mesh, ...)
+	UPROPERTY(VisibleAnywhere, BlueprintReadonly, Category = "glTFRuntime")
+	TArray<int32> DirtyNodes;
+
+	// meshes whose geometry (or materials) must be rebuilt
+	UPROPERTY(VisibleAnywhere, BlueprintReadonly, Category = "glTFRuntime")
+	TArray<int32> DirtyMeshes;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadonly, Category = "glTFRuntime")
+	TArray<int32> DirtyMaterials;
+
+	// nodes were added/removed/reparented or scenes/skins changed: only a full reload is safe
+	UPROPERTY(VisibleAnywhere, BlueprintReadonly, Category = "glTFRuntime")
+	bool bStructureChanged;
+
+	FglTFRuntimeSceneUpdate()
+	{
+		bStructureChanged = false;
+	}
+};
+
+// a parsed revision of the asset not applied yet (see FglTFRuntimeParser::DiffFromString)
+struct GLTFRUNTIME_API FglTFRuntimePendingUpdate
+{
+	TSharedPtr<FJsonObject> Root;
+	TMap<FString, TSharedRef<const FBinaryData, ESPMode::ThreadSafe>> ChangedAux;
+
+	TSet<int32> DirtyBuffers;
+	TSet<int32> DirtyBufferViews;
+	TSet<int32> DirtyAccessors;
+	TSet<int32> DirtyTextures;
+	TSet<int32> DirtyMaterials;
+	TSet<int32> DirtyMeshes;
+
+	// reads the mesh of a node from the new revision (INDEX_NONE if the node has no mesh)
+	bool GetNodeMeshIndex(const int32 NodeIndex, int32& MeshIndex) const;
+};
+
 
 USTRUCT(BlueprintType)
 struct FglTFRuntimeNode
@@ -448,6 +525,11 @@ struct FglTFRuntimeImagesConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bStreaming;
 
+	// (requires bStreaming) only the smallest mips and the encoded image are kept in memory, the others are decoded again
+	// from the source image on every streamer request (PNG/JPEG sources are still fully decoded once at load for the resident mips)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bStreamFromSource;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	int32 LODBias;
 
@@ -462,6 +544,7 @@ struct FglTFRuntimeImagesConfig
 		bForceHDR = false;
 		bCompressMips = false;
 		bStreaming = false;
+		bStreamFromSource = false;
 		LODBias = 0;
 	}
 };
@@ -555,6 +638,11 @@ struct FglTFRuntimeMaterialsConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bLoadMipMaps;
 
+	// decode the images of all of the asset materials in parallel when the first material is loaded
+	// (the texture delegates are still broadcast on the loading thread, binding the decoding ones disables the parallelism)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bPrefetchTextures;
+
 	FglTFRuntimeMaterialsConfig()
 	{
 		CacheMode = EglTFRuntimeCacheMode::ReadWrite;
@@ -566,6 +654,100 @@ struct FglTFRuntimeMaterialsConfig
 		bSkipLoad = false;
 		VertexColorOnlyMaterial = nullptr;
 		bLoadMipMaps = false;
+		bPrefetchTextures = false;
+	}
+};
+
+UENUM()
+enum class EglTFRuntimePointCloudMode : uint8
+{
+	// choose by point count (see FglTFRuntimePointCloudConfig::SelectMode)
+	Auto,
+	// an instanced static mesh glyph per point
+	Glyphs,
+	// all of the points uploaded at once to the niagara point system
+	Sprites,
+	// octree chunks streamed to the niagara point system based on the view and the point budget
+	Streaming
+};
+
+USTRUCT(BlueprintType)
+struct FglTFRuntimePointCloudConfig
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimePointCloudMode Mode;
+
+	// in Auto mode, clouds up to this size use glyphs
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 MaxGlyphs;
+
+	// maximum number of points on the GPU, in Auto mode bigger clouds are streamed
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 PointBudget;
+
+	// if null, the plugin sphere is used
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	UStaticMesh* GlyphMesh;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float GlyphScale;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 MaxPointsPerChunk;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 MaxOctreeDepth;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float MinChunkScreenSize;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bFrustumCulling;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float CullChunkScreenSize;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bQuantizedPositions;
+
+	// if null, /glTFRuntime/P_Point_glTFRuntime is used. A custom system spawns User.Count particles and must expose
+	// User.PositionTexture, User.ColorTexture, User.TextureWidth and User.TextureHeight (particle N reads texel N).
+	// Custom attributes need User.AttributeTexture0..N (4 attributes per texture) and User.AttributeCount,
+	// quantized positions need User.ChunkBoundsTexture and User.ChunkBoundsWidth (see UglTFRuntimePointCloudComponent)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	UNiagaraSystem* NiagaraSystem;
+
+	EglTFRuntimePointCloudMode SelectMode(const int32 NumPoints) const
+	{
+		if (Mode != EglTFRuntimePointCloudMode::Auto)
+		{
+			return Mode;
+		}
+
+		if (NumPoints <= MaxGlyphs)
+		{
+			return EglTFRuntimePointCloudMode::Glyphs;
+		}
+
+		return NumPoints <= PointBudget ? EglTFRuntimePointCloudMode::Sprites : EglTFRuntimePointCloudMode::Streaming;
+	}
+
+	FglTFRuntimePointCloudConfig()
+	{
+		Mode = EglTFRuntimePointCloudMode::Auto;
+		MaxGlyphs = 50000;
+		PointBudget = 1000000;
+		GlyphMesh = nullptr;
+		GlyphScale = 0.1f;
+		MaxPointsPerChunk = 16384;
+		MaxOctreeDepth = 12;
+		MinChunkScreenSize = 0.01f;
+		bFrustumCulling = true;
+		CullChunkScreenSize = 0;
+		bQuantizedPositions = false;
+		NiagaraSystem = nullptr;
 	}
 };
 
@@ -643,6 +825,10 @@ struct FglTFRuntimeStaticMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	float LODScreenSizeMultiplier;
 
+	// rendering of POINTS and LINES primitives
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	FglTFRuntimePointCloudConfig PointCloudConfig;
+
 	template<typename T>
 	T* GetCustomConfig() const
 	{
@@ -1322,20 +1508,27 @@ struct FglTFRuntimePrimitive
 	TArray<TArray<FglTFRuntimeUInt16Vector4>> Joints;
 	TArray<TArray<FVector4>> Weights;
 	TArray<FVector4> Colors;
+	// scalar application specific attributes (_XXX), only loaded for points
+	TMap<FString, TArray<float>> CustomAttributes;
 	TArray<FglTFRuntimeMorphTarget> MorphTargets;
 	TMap<int32, FName> OverrideBoneMap;
 	TMap<int32, int32> BonesCache;
 	FString MaterialName;
 	int64 AdditionalBufferView;
 	int32 Mode;
+	int64 MaterialIndex;
 	bool bHasMaterial;
+	// primitives decoded on a worker only know their material index, the game thread continuation loads the material
+	bool bMaterialPending;
 	bool bHighPrecisionUVs;
 	bool bHighPrecisionWeights;
 
 	FglTFRuntimePrimitive()
 	{
 		AdditionalBufferView = INDEX_NONE;
+		MaterialIndex = INDEX_NONE;
 		bHasMaterial = false;
+		bMaterialPending = false;
 		bHighPrecisionUVs = false;
 		bHighPrecisionWeights = false;
 		Material = nullptr;
@@ -1343,9 +1536,22 @@ struct FglTFRuntimePrimitive
 	}
 };
 
+// keeps the cached LODs of the parser alive (even across updates) while mesh contexts point to them
+struct GLTFRUNTIME_API FglTFRuntimeLODsPin
+{
+	TSharedRef<class FglTFRuntimeParser> Parser;
+
+	FglTFRuntimeLODsPin(TSharedRef<class FglTFRuntimeParser> InParser);
+	~FglTFRuntimeLODsPin();
+
+	FglTFRuntimeLODsPin(const FglTFRuntimeLODsPin&) = delete;
+	FglTFRuntimeLODsPin& operator=(const FglTFRuntimeLODsPin&) = delete;
+};
+
 struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 {
 	TSharedRef<class FglTFRuntimeParser> Parser;
+	FglTFRuntimeLODsPin LODsPin;
 
 	TArray<FglTFRuntimeMeshLOD*> LODs;
 
@@ -1359,6 +1565,9 @@ struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 
 	TMap<int32, FBox> PerBoneBoundingBoxCache;
 
+	// glTF vertex index of each render vertex (per LOD and section), used for mapping morph targets
+	TArray<TArray<TArray<uint32>>> LODsSectionsVertices;
+
 	// here we cache per-context LODs
 	TArray<FglTFRuntimeMeshLOD> CachedRuntimeMeshLODs;
 
@@ -1366,7 +1575,7 @@ struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 	TArray<FglTFRuntimeMeshLOD> ContextLODs;
 	TMap<int32, int32> ContextLODsMap;
 
-	FglTFRuntimeSkeletalMeshContext(TSharedRef<FglTFRuntimeParser> InParser, const FglTFRuntimeSkeletalMeshConfig& InSkeletalMeshConfig) : Parser(InParser), SkeletalMeshConfig(InSkeletalMeshConfig)
+	FglTFRuntimeSkeletalMeshContext(TSharedRef<FglTFRuntimeParser> InParser, const FglTFRuntimeSkeletalMeshConfig& InSkeletalMeshConfig) : Parser(InParser), LODsPin(InParser), SkeletalMeshConfig(InSkeletalMeshConfig)
 	{
 		EObjectFlags Flags = RF_Public;
 		UObject* Outer = InSkeletalMeshConfig.Outer ? InSkeletalMeshConfig.Outer : GetTransientPackage();
@@ -1556,6 +1765,7 @@ struct FglTFRuntimeMeshLOD
 struct FglTFRuntimeStaticMeshContext : public FGCObject
 {
 	TSharedRef<class FglTFRuntimeParser> Parser;
+	FglTFRuntimeLODsPin LODsPin;
 
 	TArray<const FglTFRuntimeMeshLOD*> LODs;
 
@@ -1566,11 +1776,17 @@ struct FglTFRuntimeStaticMeshContext : public FGCObject
 	FBoxSphereBounds BoundingBoxAndSphere;
 	FVector LOD0PivotDelta = FVector::ZeroVector;
 	TArray<FStaticMaterial> StaticMaterials;
+	// StaticMaterials slots whose material is still pending, resolved by FinalizeStaticMesh
+	TMap<int32, const FglTFRuntimePrimitive*> PendingStaticMaterials;
 
 	TMap<FString, FTransform> AdditionalSockets;
 	TArray<FglTFRuntimeMeshLOD> ContextLODs;
 	TMap<int32, int32> ContextLODsMap;
 
+	// Keep track of whether to finalize static mesh after generation.
+	// (For example: The glypher sphere is already ready, and therefore does not need to be finalized)
+	bool bFinalizeStaticMesh = true;
+
 	FglTFRuntimeStaticMeshContext(TSharedRef<FglTFRuntimeParser> InParser, const FglTFRuntimeStaticMeshConfig& InStaticMeshConfig);
 
 	FString GetReferencerName() const override
@@ -1644,13 +1860,38 @@ struct FglTFRuntimeMipMap
 	}
 };
 
+// encoded image of a texture streamed with bStreamFromSource (decoding does not require the parser)
+struct FglTFRuntimeTextureStreamingSource
+{
+	int32 TextureIndex;
+	// can be shared with the aux data, this is the only data kept between stream requests
+	TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> EncodedBytes;
+	bool sRGB;
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	// final format of the mips (they could have been block compressed after decoding)
+	EPixelFormat PixelFormat;
+	// mips without bulk data
+	int32 NumStreamedMips;
+
+	FglTFRuntimeTextureStreamingSource()
+	{
+		TextureIndex = INDEX_NONE;
+		sRGB = false;
+		PixelFormat = EPixelFormat::PF_Unknown;
+		NumStreamedMips = 0;
+	}
+
+	// decodes mips [FirstMipIndex, LastMipIndex] for a single stream request (OutMips[0] is FirstMipIndex), the caller owns (and frees) them
+	bool DecodeMips(const int32 FirstMipIndex, const int32 LastMipIndex, TArray<FglTFRuntimeMipMap>& OutMips) const;
+};
+
 class FglTFRuntimeTextureMipDataProvider : public FTextureMipDataProvider
 {
 public:
 #if ENGINE_MAJOR_VERSION >= 5 || ENGINE_MINOR_VERSION >= 26
-	FglTFRuntimeTextureMipDataProvider(const UTexture* Texture, ETickState InTickState, ETickThread InTickThread) : FTextureMipDataProvider(Texture, InTickState, InTickThread)
+	FglTFRuntimeTextureMipDataProvider(const UTexture* Texture, ETickState InTickState, ETickThread InTickThread, TSharedPtr<FglTFRuntimeTextureStreamingSource, ESPMode::ThreadSafe> InStreamingSource = nullptr) : FTextureMipDataProvider(Texture, InTickState, InTickThread), StreamingSource(InStreamingSource), bMipsFailed(false)
 #else
-	FglTFRuntimeTextureMipDataProvider(ETickState InTickState, ETickThread InTickThread) : FTextureMipDataProvider(InTickState, InTickThread)
+	FglTFRuntimeTextureMipDataProvider(ETickState InTickState, ETickThread InTickThread, TSharedPtr<FglTFRuntimeTextureStreamingSource, ESPMode::ThreadSafe> InStreamingSource = nullptr) : FTextureMipDataProvider(InTickState, InTickThread), StreamingSource(InStreamingSource), bMipsFailed(false)
 #endif
 	{
 	}
@@ -1665,7 +1906,8 @@ public:
 	bool PollMips(const FTextureUpdateSyncOptions& SyncOptions)
 	{
 		AdvanceTo(ETickState::Done, ETickThread::None);
-		return true;
+		// cancels the update, the texture keeps its current resolution
+		return !bMipsFailed;
 	}
 
 	void CleanUp(const FTextureUpdateSyncOptions& SyncOptions)
@@ -1682,6 +1924,9 @@ public:
 		return ETickThread::None;
 	}
 
+protected:
+	TSharedPtr<FglTFRuntimeTextureStreamingSource, ESPMode::ThreadSafe> StreamingSource;
+	bool bMipsFailed;
 };
 
 UCLASS()
@@ -1691,11 +1936,14 @@ class UglTFRuntimeTextureMipDataProviderFactory : public UTextureMipDataProvider
 
 public:
 #if ENGINE_MAJOR_VERSION >= 5 || ENGINE_MINOR_VERSION >= 26
-	virtual FTextureMipDataProvider* AllocateMipDataProvider(UTexture* Asset) { return new FglTFRuntimeTextureMipDataProvider(Asset, FTextureMipDataProvider::ETickState::Init, FTextureMipDataProvider::ETickThread::Async); }
+	virtual FTextureMipDataProvider* AllocateMipDataProvider(UTexture* Asset) { return new FglTFRuntimeTextureMipDataProvider(Asset, FTextureMipDataProvider::ETickState::Init, FTextureMipDataProvider::ETickThread::Async, StreamingSource); }
 #else
-	virtual FTextureMipDataProvider* AllocateMipDataProvider() { return new FglTFRuntimeTextureMipDataProvider(FTextureMipDataProvider::ETickState::Init, FTextureMipDataProvider::ETickThread::Async); }
+	virtual FTextureMipDataProvider* AllocateMipDataProvider() { return new FglTFRuntimeTextureMipDataProvider(FTextureMipDataProvider::ETickState::Init, FTextureMipDataProvider::ETickThread::Async, StreamingSource); }
 #endif
 
+	// set for textures streamed with bStreamFromSource
+	TSharedPtr<FglTFRuntimeTextureStreamingSource, ESPMode::ThreadSafe> StreamingSource;
+
 #if ENGINE_MAJOR_VERSION >= 5
 	virtual bool WillProvideMipDataWithoutDisk() const override { return true; }
 #endif
@@ -1929,12 +2177,30 @@ protected:
 	const TArray64<uint8>& Data;
 };
 
+// CPU block compression of PF_B8G8R8A8 mips (FglTFRuntimeImagesConfig::bCompressMips)
+class FglTFRuntimeTextureCompressor
+{
+public:
+	// BC5 for normal maps, BC3 when the alpha channel is used, BC1 otherwise
+	static EPixelFormat GetPixelFormat(const FglTFRuntimeMipMap& MipMap, const bool bNormalMap);
+	// returns false (leaving the mips untouched) when the format or the size are not supported
+	static bool CompressMips(TArray<FglTFRuntimeMipMap>& Mips, const bool bNormalMap);
+	static bool CompressMips(TArray<FglTFRuntimeMipMap>& Mips, const EPixelFormat PixelFormat);
+};
+
 // generic struct for plugins cache
 struct FglTFRuntimePluginCacheData
 {
 	bool bValid = false;
 };
 
+enum class EglTFRuntimeAsyncPriority : uint8
+{
+	High,
+	Normal,
+	Low
+};
+
 DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeStaticMeshAsync, UStaticMesh*, StaticMesh);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeSkeletalMeshAsync, USkeletalMesh*, SkeletalMesh);
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FglTFRuntimeMeshLODAsync, const bool, bValid, const FglTFRuntimeMeshLOD&, MeshLOD);
@@ -1969,6 +2235,24 @@ public:
 	static TSharedPtr<FglTFRuntimeParser> FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr);
 	static TSharedPtr<FglTFRuntimeParser> FromString(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig, const TMap<FString, FBinaryData>& aux, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr);
 	static TSharedPtr<FglTFRuntimeParser> FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig);
+	// takes ownership of the data, plain GLB files are parsed in place (the BIN chunk is never copied)
+	static TSharedPtr<FglTFRuntimeParser> FromOwnedData(TArray64<uint8>&& Data, const FglTFRuntimeConfig& LoaderConfig);
+
+	// replaces the json (and the changed aux buffers) of the asset, only the caches depending on what changed are invalidated.
+	// Same as DiffFromString() followed by ApplyUpdate().
+	bool UpdateFromString(const FString& JsonData, const TMap<FString, FBinaryData>& ChangedAux, FglTFRuntimeSceneUpdate& SceneUpdate);
+	// computes what changed in a new revision of the asset without touching the parser
+	bool DiffFromString(const FString& JsonData, const TMap<FString, FBinaryData>& ChangedAux, FglTFRuntimeSceneUpdate& SceneUpdate, FglTFRuntimePendingUpdate& PendingUpdate);
+	// switches to the new revision, LODs still referenced by running async loads are kept alive until they complete
+	void ApplyUpdate(const FglTFRuntimePendingUpdate& PendingUpdate);
+
+	// mesh contexts (and async LOD loads) pin the cached LODs they point to
+	void PinLODs();
+	void UnpinLODs();
+
+	// async work goes to the bounded glTFRuntime pool, game thread continuations are queued without blocking the worker
+	static void RunOnWorkerPool(TUniqueFunction<void()>&& Work, const EglTFRuntimeAsyncPriority Priority = EglTFRuntimeAsyncPriority::Normal);
+	static void RunOnGameThread(TUniqueFunction<void()>&& Work);
 
 	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromBinary(const TArray<uint8> Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr) { return FromBinary(Data.GetData(), Data.Num(), LoaderConfig, InZipFile); }
 	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromBinary(const TArray64<uint8> Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr) { return FromBinary(Data.GetData(), Data.Num(), LoaderConfig, InZipFile); }
@@ -1994,6 +2278,9 @@ public:
 
 	UMaterialInterface* LoadMaterial(const int32 MaterialIndex, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bUseVertexColors, FString& MaterialName);
 	UTexture2D* LoadTexture(const int32 TextureIndex, TArray<FglTFRuntimeMipMap>& Mips, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig, FglTFRuntimeTextureSampler& Sampler);
+	void PrefetchTextures(const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+	// frees the prefetched mips not consumed by the load pass (the textures are not prefetched again)
+	void ReleasePrefetchedTextures();
 
 	bool LoadNodes();
 	bool LoadNode(const int32 NodeIndex, FglTFRuntimeNode& Node);
@@ -2053,6 +2340,12 @@ public:
 
 	bool LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 	bool LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+	bool LoadPrimitiveGeometry(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive);
+	bool LoadPrimitiveMaterial(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+	UMaterialInterface* LoadPrimitiveMaterial(const int64 MaterialIndex, const bool bUseVertexColors, const FglTFRuntimeMaterialsConfig& MaterialsConfig, FString& MaterialName);
+	int64 GetPrimitiveMaterialIndex(TSharedRef<FJsonObject> JsonPrimitiveObject, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+	bool ResolvePendingMaterials(FglTFRuntimeMeshLOD& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+	bool LoadPrimitivesParallel(const TArray<TSharedPtr<FJsonValue>>& JsonPrimitives, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 
 	void AddError(const FString& ErrorContext, const FString& ErrorMessage);
 	void ClearErrors();
@@ -2072,9 +2365,27 @@ public:
 	void SetBinaryBuffer(const TArray64<uint8>& InBinaryBuffer)
 	{
 		BinaryBuffer = InBinaryBuffer;
+		BinaryChunk = FglTFRuntimeBlob();
+	}
+
+	void SetBinaryBuffer(const uint8* Data, const int64 Num)
+	{
+		BinaryBuffer.Empty(Num);
+		BinaryBuffer.Append(Data, Num);
+		BinaryChunk = FglTFRuntimeBlob();
+	}
+
+	// the parser keeps the whole GLB alive, the BIN chunk (buffer 0) is a view into it
+	void SetBinaryBuffer(TArray64<uint8>&& InSourceData, const int64 Offset, const int64 Num)
+	{
+		SourceData = MoveTemp(InSourceData);
+		BinaryBuffer.Empty();
+		BinaryChunk.Data = SourceData.GetData() + Offset;
+		BinaryChunk.Num = Num;
 	}
 
-	TMap<FString, FBinaryData> AuxilliaryData;
+	// entries are shared with the buffers cache, so no copy is made when a buffer is requested
+	TMap<FString, TSharedRef<const FBinaryData, ESPMode::ThreadSafe>> AuxilliaryData;
 
 	bool LoadStaticMeshIntoProceduralMeshComponent(const int32 MeshIndex, UProceduralMeshComponent* ProceduralMeshComponent, const FglTFRuntimeProceduralMeshConfig& ProceduralMeshConfig);
 
@@ -2107,9 +2418,11 @@ public:
 	FString GetVersion() const;
 	FString GetGenerator() const;
 
-	bool LoadImageBytes(const int32 ImageIndex, TSharedPtr<FJsonObject>& JsonImageObject, TArray64<uint8>& Bytes);
+	bool LoadImageBytes(const int32 ImageIndex, TSharedPtr<FJsonObject>& JsonImageObject, TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe>& Bytes);
 	bool LoadImage(const int32 ImageIndex, TArray64<uint8>& UncompressedBytes, int32& Width, int32& Height, EPixelFormat& PixelFormat, const FglTFRuntimeImagesConfig& ImagesConfig);
 	bool LoadImageFromBlob(const TArray64<uint8>& Blob, TSharedRef<FJsonObject> JsonImageObject, TArray64<uint8>& UncompressedBytes, int32& Width, int32& Height, EPixelFormat& PixelFormat, const FglTFRuntimeImagesConfig& ImagesConfig);
+	// DDS/ImageWrapper decoding without the plugins hooks
+	static bool DecodeImage(const TArray64<uint8>& Blob, TArray64<uint8>& UncompressedBytes, int32& Width, int32& Height, EPixelFormat& PixelFormat, const FglTFRuntimeImagesConfig& ImagesConfig, FString& Error);
 	UTexture2D* BuildTexture(UObject* Outer, const TArray<FglTFRuntimeMipMap>& Mips, const FglTFRuntimeImagesConfig& ImagesConfig, const FglTFRuntimeTextureSampler& Sampler);
 	UTextureCube* BuildTextureCube(UObject* Outer, const TArray<FglTFRuntimeMipMap>& MipsXP, const TArray<FglTFRuntimeMipMap>& MipsXN, const TArray<FglTFRuntimeMipMap>& MipsYP, const TArray<FglTFRuntimeMipMap>& MipsYN, const TArray<FglTFRuntimeMipMap>& MipsZP, const TArray<FglTFRuntimeMipMap>& MipsZN, const bool bAutoRotate, const FglTFRuntimeImagesConfig& ImagesConfig, const FglTFRuntimeTextureSampler& Sampler);
 	UTexture2DArray* BuildTextureArray(UObject* Outer, const TArray<FglTFRuntimeMipMap>& Mips,const FglTFRuntimeImagesConfig& ImagesConfig, const FglTFRuntimeTextureSampler& Sampler);
@@ -2225,35 +2538,60 @@ protected:
 	TMap<int32, USkeletalMesh*> SkeletalMeshesCache;
 	TMap<int32, UTexture2D*> TexturesCache;
 
+	// encoded images of the textures streamed with bStreamFromSource (keyed by texture index and sRGB), moved to the texture by BuildTexture
+	TMap<TPair<int32, bool>, TSharedPtr<FglTFRuntimeTextureStreamingSource, ESPMode::ThreadSafe>> TextureStreamingSources;
+	FCriticalSection TextureStreamingSourcesLock;
+	void AddTextureStreamingSource(const int32 TextureIndex, TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> EncodedBytes, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+
+	// mips decoded by PrefetchTextures (keyed by texture index and sRGB), consumed by LoadTexture
+	// and emptied when all of the materials scanned by PrefetchTextures have been loaded (or by ReleasePrefetchedTextures)
+	TMap<TPair<int32, bool>, TArray<FglTFRuntimeMipMap>> PrefetchedMipsCache;
+	TSet<int32> PrefetchPendingMaterials;
+	FCriticalSection PrefetchedMipsCacheLock;
+	FThreadSafeBool bTexturesPrefetched;
+
+	// decoded-data caches can be filled by concurrent decoders, entries are only removed by UpdateFromString
+	// so blobs pointing into them stay valid while loading
 	TMap<int32, TArray64<uint8>> BuffersCache;
+	TMap<int32, TSharedPtr<FglTFRuntimeMappedBuffer>> MappedBuffersCache;
+	TMap<int32, TSharedPtr<const FBinaryData, ESPMode::ThreadSafe>> AuxBuffersCache;
+	FRWLock BuffersCacheLock;
+	bool bMapExternalFiles;
+	bool bParallelPrimitivesDecoding;
 	TMap<int32, TArray64<uint8>> CompressedBufferViewsCache;
 	TMap<int32, int64> CompressedBufferViewsStridesCache;
+	FRWLock CompressedBufferViewsCacheLock;
 
 	TMap<UMaterialInterface*, FString> MaterialsNameCache;
+	FRWLock MaterialsCacheLock;
+	// textures are built on the game thread, but the cache is read by the prefetch and async loaders
+	FRWLock TexturesCacheLock;
 
 	TArray<FglTFRuntimeNode> AllNodesCache;
-	bool bAllNodesCached;
+	FThreadSafeBool bAllNodesCached;
+	FCriticalSection AllNodesCacheLock;
 
-	TMap<TSharedRef<FJsonObject>, FglTFRuntimeMeshLOD> LODsCache;
+	// values are shared pointers so returned LODs survive map growth
+	TMap<TSharedRef<FJsonObject>, TSharedPtr<FglTFRuntimeMeshLOD>> LODsCache;
+	// LODs replaced by an update while pinned, released by the last UnpinLODs()
+	TArray<TSharedPtr<FglTFRuntimeMeshLOD>> RetiredLODs;
+	int32 LODsPins = 0;
+	FRWLock LODsCacheLock;
 
 	TArray64<uint8> BinaryBuffer;
 
-	// Injecting Pointcloud Data
-	UTexture2D* PositionTexture;
-	UTexture2D* ColorTexture;
-	FUpdateTextureRegion2D Region;
-	uint8* PositionData;
-	uint8* ColorData;
+	// set when the parser owns the original GLB (see FromOwnedData)
+	TArray64<uint8> SourceData;
+	FglTFRuntimeBlob BinaryChunk;
 
-	// Keep track of whether to finalize static mesh after generation.
-	// (For example: The glypher sphere is already ready, and therefore does not need to be finalized)
-	bool bFinalizeStaticMesh;
+	static bool GetBinaryChunks(const uint8* DataPtr, const int64 DataNum, FString& JsonData, int64& BinaryChunkOffset, int64& BinaryChunkNum);
+
+	bool FindCachedBuffer(const int32 Index, FglTFRuntimeBlob& Blob);
+	void CacheBuffer(const int32 Index, TArray64<uint8>&& Data, FglTFRuntimeBlob& Blob);
 
 	bool LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 	UStaticMesh* LoadStaticMesh_Internal(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext);
 	UStaticMesh* LoadStaticMesh_Internal(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext, UStaticMeshComponent*& StaticMeshComponent);
-	void InjectPointcloudData(UNiagaraComponent* PointCloud, TArray<float>& Positions, TArray<uint8_t>& Colors, const int32 PointCount);
-	void SetNiagaraVariableTexture(UNiagaraComponent* PointCloud, const FString VariableName, UTexture* Texture);
 	UMaterialInterface* LoadMaterial_Internal(const int32 Index, const FString& MaterialName, TSharedRef<FJsonObject> JsonMaterialObject, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bUseVertexColors);
 	bool LoadNode_Internal(int32 Index, TSharedRef<FJsonObject> JsonNodeObject, int32 NodesCount, FglTFRuntimeNode& Node);
 
@@ -2294,6 +2632,8 @@ public:
 
 
 	bool GetJsonObjectBytes(TSharedRef<FJsonObject> JsonObject, TArray64<uint8>& Bytes);
+	// like the TArray64 version, but aux bytes owned by the producer are referenced instead of copied
+	bool GetJsonObjectBytes(TSharedRef<FJsonObject> JsonObject, TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe>& SharedBytes);
 	bool GetJsonObjectBool(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const bool DefaultValue);
 
 	TMap<EglTFRuntimeMaterialType, UMaterialInterface*>& GetMetallicRoughnessMaterialsMap() { return MetallicRoughnessMaterialsMap; };
@@ -2333,6 +2673,10 @@ protected:
 	TMap<EglTFRuntimeMaterialType, UMaterialInterface*> ClearCoatMaterialsMap;
 
 	TArray<FString> Errors;
+	// errors reported outside of the game thread, OnError is broadcast for them by BroadcastPendingErrors
+	TArray<TPair<FString, FString>> PendingErrors;
+	FCriticalSection ErrorsLock;
+	void BroadcastPendingErrors();
 
 	FString BaseDirectory;
 
@@ -2354,6 +2698,159 @@ public:
 		return FTransform(SceneBasis.Inverse() * M * SceneBasis);
 	}
 
+	static FORCEINLINE float NormalizeAccessorComponent(const float Value) { return Value; }
+	static FORCEINLINE float NormalizeAccessorComponent(const int8 Value) { return FMath::Max(((float)Value) / 127.f, -1.f); }
+	static FORCEINLINE float NormalizeAccessorComponent(const uint8 Value) { return ((float)Value) / 255.f; }
+	static FORCEINLINE float NormalizeAccessorComponent(const int16 Value) { return FMath::Max(((float)Value) / 32767.f, -1.f); }
+	static FORCEINLINE float NormalizeAccessorComponent(const uint16 Value) { return ((float)Value) / 65535.f; }
+
+	// identity filter, allows BuildFromAccessorField to copy tightly packed float accessors as is
+	struct FAccessorIdentity
+	{
+		template<typename T>
+		FORCEINLINE T operator()(const T& Value) const { return Value; }
+	};
+
+	// affine filter (basis change and scene scale), allows BuildFromAccessorField to convert and transform float3 accessors in a single pass
+	struct FAccessorAffineTransform
+	{
+		FMatrix Matrix;
+
+		FAccessorAffineTransform(const FMatrix& InMatrix, const bool bTranslate) : Matrix(InMatrix)
+		{
+			if (!bTranslate)
+			{
+				Matrix.SetOrigin(FVector::ZeroVector);
+			}
+		}
+
+		FORCEINLINE FVector operator()(const FVector& Value) const { return Matrix.TransformPosition(Value); }
+	};
+
+	// float3 -> FVector (double on UE5) conversion fused with the transform, no per-element filter call
+	static bool DecodeAccessorTransformed(const uint8* Data, const int64 Stride, const int64 Count, FVector* OutData, const FAccessorAffineTransform& Filter)
+	{
+		const auto M00 = Filter.Matrix.M[0][0], M01 = Filter.Matrix.M[0][1], M02 = Filter.Matrix.M[0][2];
+		const auto M10 = Filter.Matrix.M[1][0], M11 = Filter.Matrix.M[1][1], M12 = Filter.Matrix.M[1][2];
+		const auto M20 = Filter.Matrix.M[2][0], M21 = Filter.Matrix.M[2][1], M22 = Filter.Matrix.M[2][2];
+		const auto M30 = Filter.Matrix.M[3][0], M31 = Filter.Matrix.M[3][1], M32 = Filter.Matrix.M[3][2];
+
+		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		{
+			const float* Ptr = reinterpret_cast<const float*>(Data + ElementIndex * Stride);
+			const decltype(M00) X = Ptr[0];
+			const decltype(M00) Y = Ptr[1];
+			const decltype(M00) Z = Ptr[2];
+			FVector& Value = OutData[ElementIndex];
+			Value.X = X * M00 + Y * M10 + Z * M20 + M30;
+			Value.Y = X * M01 + Y * M11 + Z * M21 + M31;
+			Value.Z = X * M02 + Y * M12 + Z * M22 + M32;
+		}
+		return true;
+	}
+
+	template<typename T, typename Callback>
+	static bool DecodeAccessorTransformed(const uint8* Data, const int64 Stride, const int64 Count, T* OutData, const Callback& Filter)
+	{
+		return false;
+	}
+
+	// true when T is laid out as Elements contiguous floats
+	template<typename T>
+	static bool IsPackedFloatElement(const int64 Elements)
+	{
+		return TIsSame<decltype(DeclVal<T&>()[0]), float&>::Value && sizeof(T) == Elements * sizeof(float);
+	}
+
+	// component type, normalization and number of elements are resolved before entering the loop (one specialization per combination)
+	template<typename ComponentT, bool bNormalized, int32 NumElements, typename T, typename Callback>
+	static void DecodeAccessorElements(const uint8* Data, const int64 Stride, const int64 Count, T* OutData, Callback& Filter)
+	{
+		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		{
+			const ComponentT* Ptr = reinterpret_cast<const ComponentT*>(Data + ElementIndex * Stride);
+			T Value;
+			for (int32 i = 0; i < NumElements; i++)
+			{
+				if (bNormalized)
+				{
+					Value[i] = NormalizeAccessorComponent(Ptr[i]);
+				}
+				else
+				{
+					Value[i] = Ptr[i];
+				}
+			}
+			OutData[ElementIndex] = Filter(Value);
+		}
+	}
+
+	template<typename ComponentT, bool bNormalized, typename T, typename Callback>
+	static void DecodeAccessorElements(const uint8* Data, const int64 Stride, const int64 Elements, const int64 Count, T* OutData, Callback& Filter)
+	{
+		switch (Elements)
+		{
+		case 2:
+			DecodeAccessorElements<ComponentT, bNormalized, 2>(Data, Stride, Count, OutData, Filter);
+			return;
+		case 3:
+			DecodeAccessorElements<ComponentT, bNormalized, 3>(Data, Stride, Count, OutData, Filter);
+			return;
+		case 4:
+			DecodeAccessorElements<ComponentT, bNormalized, 4>(Data, Stride, Count, OutData, Filter);
+			return;
+		default:
+			break;
+		}
+
+		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		{
+			const ComponentT* Ptr = reinterpret_cast<const ComponentT*>(Data + ElementIndex * Stride);
+			T Value;
+			for (int32 i = 0; i < Elements; i++)
+			{
+				if (bNormalized)
+				{
+					Value[i] = NormalizeAccessorComponent(Ptr[i]);
+				}
+				else
+				{
+					Value[i] = Ptr[i];
+				}
+			}
+			OutData[ElementIndex] = Filter(Value);
+		}
+	}
+
+	template<typename ComponentT, bool bNormalized, typename T, typename Callback>
+	static void DecodeAccessorScalars(const uint8* Data, const int64 Stride, const int64 Count, T* OutData, Callback& Filter)
+	{
+		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		{
+			const ComponentT* Ptr = reinterpret_cast<const ComponentT*>(Data + ElementIndex * Stride);
+			T Value;
+			if (bNormalized)
+			{
+				Value = NormalizeAccessorComponent(*Ptr);
+			}
+			else
+			{
+				Value = *Ptr;
+			}
+			OutData[ElementIndex] = Filter(Value);
+		}
+	}
+
+	// contiguous source and destination without per-element strides, the compiler turns this into vector widening moves
+	template<typename ComponentT>
+	static void WidenIndices(const ComponentT* RESTRICT Data, const int64 Count, uint32* RESTRICT OutData)
+	{
+		for (int64 Index = 0; Index < Count; Index++)
+		{
+			OutData[Index] = Data[Index];
+		}
+	}
+
 	template<typename T, typename Callback>
 	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, Callback Filter, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
 	{
@@ -2387,64 +2884,70 @@ public:
 			*ComponentTypePtr = ComponentType;
 		}
 
-		Data.AddUninitialized(Count);
-		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		const int64 Offset = Data.AddUninitialized(Count);
+		T* OutData = Data.GetData() + Offset;
+
+		// tightly packed floats without conversions (sparse accessors are already resolved by GetAccessor)
+		if (TIsSame<Callback, FAccessorIdentity>::Value && ComponentType == 5126 && Stride == Elements * static_cast<int64>(sizeof(float)) && IsPackedFloatElement<T>(Elements))
 		{
-			int64 Index = ElementIndex * Stride;
-			T Value;
-			// FLOAT
-			if (ComponentType == 5126)
+			FMemory::Memcpy(OutData, Blob.Data, Count * Stride);
+			return true;
+		}
+
+		if (ComponentType == 5126 && Elements == 3 && DecodeAccessorTransformed(Blob.Data, Stride, Count, OutData, Filter))
+		{
+			return true;
+		}
+
+		switch (ComponentType)
+		{
+		case 5126: // FLOAT
+			DecodeAccessorElements<float, false>(Blob.Data, Stride, Elements, Count, OutData, Filter);
+			break;
+		case 5120: // BYTE
+			if (bNormalized)
 			{
-				float* Ptr = (float*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = Ptr[i];
-				}
+				DecodeAccessorElements<int8, true>(Blob.Data, Stride, Elements, Count, OutData, Filter);
 			}
-			// BYTE
-			else if (ComponentType == 5120)
+			else
 			{
-				int8* Ptr = (int8*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 127.f, -1.f) : Ptr[i];
-				}
-
+				DecodeAccessorElements<int8, false>(Blob.Data, Stride, Elements, Count, OutData, Filter);
 			}
-			// UNSIGNED_BYTE
-			else if (ComponentType == 5121)
+			break;
+		case 5121: // UNSIGNED_BYTE
+			if (bNormalized)
 			{
-				uint8* Ptr = (uint8*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 255.f : Ptr[i];
-				}
+				DecodeAccessorElements<uint8, true>(Blob.Data, Stride, Elements, Count, OutData, Filter);
 			}
-			// SHORT
-			else if (ComponentType == 5122)
+			else
 			{
-				int16* Ptr = (int16*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 32767.f, -1.f) : Ptr[i];
-				}
+				DecodeAccessorElements<uint8, false>(Blob.Data, Stride, Elements, Count, OutData, Filter);
 			}
-			// UNSIGNED_SHORT
-			else if (ComponentType == 5123)
+			break;
+		case 5122: // SHORT
+			if (bNormalized)
 			{
-				uint16* Ptr = (uint16*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 65535.f : Ptr[i];
-				}
+				DecodeAccessorElements<int16, true>(Blob.Data, Stride, Elements, Count, OutData, Filter);
 			}
 			else
 			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
-				return false;
+				DecodeAccessorElements<int16, false>(Blob.Data, Stride, Elements, Count, OutData, Filter);
 			}
-
-			Data[ElementIndex] = Filter(Value);
+			break;
+		case 5123: // UNSIGNED_SHORT
+			if (bNormalized)
+			{
+				DecodeAccessorElements<uint16, true>(Blob.Data, Stride, Elements, Count, OutData, Filter);
+			}
+			else
+			{
+				DecodeAccessorElements<uint16, false>(Blob.Data, Stride, Elements, Count, OutData, Filter);
+			}
+			break;
+		default:
+			Data.RemoveAt(Offset, Count);
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
+			return false;
 		}
 
 		return true;
@@ -2483,48 +2986,58 @@ public:
 			*ComponentTypePtr = ComponentType;
 		}
 
-		Data.AddUninitialized(Count);
-		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		const int64 Offset = Data.AddUninitialized(Count);
+		T* OutData = Data.GetData() + Offset;
+
+		switch (ComponentType)
 		{
-			int64 Index = ElementIndex * Stride;
-			T Value;
-			// FLOAT
-			if (ComponentType == 5126)
+		case 5126: // FLOAT
+			DecodeAccessorScalars<float, false>(Blob.Data, Stride, Count, OutData, Filter);
+			break;
+		case 5120: // BYTE
+			if (bNormalized)
 			{
-				float* Ptr = (float*)&(Blob.Data[Index]);
-				Value = *Ptr;
+				DecodeAccessorScalars<int8, true>(Blob.Data, Stride, Count, OutData, Filter);
 			}
-			// BYTE
-			else if (ComponentType == 5120)
+			else
 			{
-				int8* Ptr = (int8*)&(Blob.Data[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 127.f, -1.f) : *Ptr;
+				DecodeAccessorScalars<int8, false>(Blob.Data, Stride, Count, OutData, Filter);
 			}
-			// UNSIGNED_BYTE
-			else if (ComponentType == 5121)
+			break;
+		case 5121: // UNSIGNED_BYTE
+			if (bNormalized)
 			{
-				uint8* Ptr = (uint8*)&(Blob.Data[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 255.f : *Ptr;
+				DecodeAccessorScalars<uint8, true>(Blob.Data, Stride, Count, OutData, Filter);
 			}
-			// SHORT
-			else if (ComponentType == 5122)
+			else
 			{
-				int16* Ptr = (int16*)&(Blob.Data[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 32767.f, -1.f) : *Ptr;
+				DecodeAccessorScalars<uint8, false>(Blob.Data, Stride, Count, OutData, Filter);
 			}
-			// UNSIGNED_SHORT
-			else if (ComponentType == 5123)
+			break;
+		case 5122: // SHORT
+			if (bNormalized)
 			{
-				uint16* Ptr = (uint16*)&(Blob.Data[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 65535.f : *Ptr;
+				DecodeAccessorScalars<int16, true>(Blob.Data, Stride, Count, OutData, Filter);
 			}
 			else
 			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
-				return false;
+				DecodeAccessorScalars<int16, false>(Blob.Data, Stride, Count, OutData, Filter);
 			}
-
-			Data[ElementIndex] = Filter(Value);
+			break;
+		case 5123: // UNSIGNED_SHORT
+			if (bNormalized)
+			{
+				DecodeAccessorScalars<uint16, true>(Blob.Data, Stride, Count, OutData, Filter);
+			}
+			else
+			{
+				DecodeAccessorScalars<uint16, false>(Blob.Data, Stride, Count, OutData, Filter);
+			}
+			break;
+		default:
+			Data.RemoveAt(Offset, Count);
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
+			return false;
 		}
 
 		return true;
@@ -2533,13 +3046,13 @@ public:
 	template<typename T>
 	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
 	{
-		return BuildFromAccessorField(JsonObject, Name, Data, SupportedElements, SupportedTypes, [&](T InValue) -> T {return InValue; }, AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
+		return BuildFromAccessorField(JsonObject, Name, Data, SupportedElements, SupportedTypes, FAccessorIdentity(), AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
 	}
 
 	template<typename T>
 	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedTypes, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
 	{
-		return BuildFromAccessorField(JsonObject, Name, Data, SupportedTypes, [&](T InValue) -> T {return InValue; }, AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
+		return BuildFromAccessorField(JsonObject, Name, Data, SupportedTypes, FAccessorIdentity(), AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
 	}
 
 	template<int32 Num, typename T>
@@ -2581,9 +3094,12 @@ protected:
 	FVector ComputeTangentY(const FVector Normal, const FVector TangetX);
 	FVector ComputeTangentYWithW(const FVector Normal, const FVector TangetX, const float W);
 
-	TArray64<uint8> ZeroBuffer;
+	// zero buffers are only appended (never grown in place) so previously returned blobs stay valid
+	TArray<TArray64<uint8>> ZeroBuffers;
+	FCriticalSection ZeroBuffersLock;
 	TMap<int32, TArray64<uint8>> SparseAccessorsCache;
 	TMap<int32, int64> SparseAccessorsStridesCache;
+	FRWLock SparseAccessorsCacheLock;
 
 	TMap<int64, TMap<FString, FglTFRuntimeBlob>> AdditionalBufferViewsCache;
 	TArray<TArray64<uint8>> AdditionalBufferViewsData;
@@ -2600,15 +3116,14 @@ public:
 	template<typename FUNCTION>
 	void LoadAsRuntimeLODAsync(FUNCTION Function, const FglTFRuntimeMeshLODAsync& AsyncCallback)
 	{
-		Async(EAsyncExecution::Thread, [Function, AsyncCallback]()
+		RunOnWorkerPool([Function, AsyncCallback]()
 			{
 				FglTFRuntimeMeshLOD LOD;
 				bool bSuccess = Function(LOD);
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, &LOD, AsyncCallback]()
+				RunOnGameThread([bSuccess, LOD = MoveTemp(LOD), AsyncCallback]()
 					{
 						AsyncCallback.ExecuteIfBound(bSuccess, bSuccess ? LOD : FglTFRuntimeMeshLOD());
-					}, TStatId(), nullptr, ENamedThreads::GameThread);
-				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+					});
 			}
 
 		);
@@ -0,0 +1,160 @@
+// Copyright 2023, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "glTFRuntimePointCloudComponent.generated.h"
+
+class UNiagaraComponent;
+class UTexture2D;
+struct FConvexVolume;
+struct FglTFRuntimePointCloudStagingPool;
+
+// position normalized to the bounds of the owning chunk (0 = Min, 65535 = Max)
+struct FglTFRuntimePointCloudQuantizedPosition
+{
+	uint16 X = 0;
+	uint16 Y = 0;
+	uint16 Z = 0;
+};
+
+struct FglTFRuntimePointCloudChunk
+{
+	FBox3f Bounds;
+	int32 Level = 0;
+	// range in the octree points storage
+	int32 FirstPoint = 0;
+	int32 NumPoints = 0;
+	TArray<int32> Children;
+};
+
+// spatial hierarchy of a point cloud: leaves hold the original points, inner chunks hold a decimated copy of their subtree
+struct GLTFRUNTIME_API FglTFRuntimePointCloudOctree
+{
+	TArray<FglTFRuntimePointCloudQuantizedPosition> Positions;
+	// used instead of Positions when a single chunk holds the whole cloud (quantizing to the cloud bounds would lose precision)
+	TArray<FVector3f> FullPrecisionPositions;
+	bool bFullPrecisionPositions = false;
+	TArray<FColor> Colors;
+	// custom scalar attributes (the _XXX glTF attributes), every array is aligned with Positions
+	TArray<FString> AttributeNames;
+	TArray<TArray<float>> Attributes;
+	// min/max of each attribute, useful for normalizing in the niagara modules
+	TArray<FVector2f> AttributeRanges;
+	// the first chunk is the root
+	TArray<FglTFRuntimePointCloudChunk> Chunks;
+
+	// positions are quantized straight from the decoded (double) glTF positions, with bQuantizePositions even a single chunk cloud is quantized
+	void Build(const TArray<FVector>& InPositions, const TArray<FColor>& InColors, const TMap<FString, TArray<float>>& InAttributes, const int32 MaxPointsPerChunk, const int32 MaxDepth, const bool bQuantizePositions);
+
+	FVector3f GetPosition(const FglTFRuntimePointCloudChunk& Chunk, const int32 ChunkPointIndex) const;
+
+	int32 GetNumPoints() const { return Colors.Num(); }
+
+protected:
+	int32 BuildChunk(const TArray<FVector>& InPositions, const TArray<FColor>& InColors, const TArray<const TArray<float>*>& InAttributes, TArray<int32>&& PointIndices, const FBox3f& Bounds, const int32 Level, const int32 MaxPointsPerChunk, const int32 MaxDepth);
+	void AddPoints(const int32 ChunkIndex, const TArray<FVector>& InPositions, const TArray<FColor>& InColors, const TArray<const TArray<float>*>& InAttributes, const TArray<int32>& PointIndices, const int32 Stride);
+};
+
+/**
+ * Streams the chunks of a point cloud octree to a Niagara point system, based on the current view and a point budget.
+ * The system (P_Point_glTFRuntime or FglTFRuntimePointCloudConfig::NiagaraSystem) receives these user parameters:
+ * User.Count (int): number of points, particle N reads texel N (row N / User.TextureWidth) of every texture
+ * User.PositionTexture, User.ColorTexture (textures) and User.TextureWidth, User.TextureHeight (int)
+ * User.AttributeTexture0..N (textures) and User.AttributeCount (int): custom attributes, see GetAttributeChannel()
+ * User.ChunkBoundsTexture (texture) and User.ChunkBoundsWidth (int): only with bQuantizedPositions
+ * Missing texture parameters are reported in the log, the shipped P_Point_glTFRuntime only exposes positions and colors.
+ */
+UCLASS(Blueprintable, meta = (BlueprintSpawnableComponent))
+class GLTFRUNTIME_API UglTFRuntimePointCloudComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+public:
+	UglTFRuntimePointCloudComponent();
+
+	void SetPointCloud(TSharedRef<FglTFRuntimePointCloudOctree> InOctree, UNiagaraComponent* InNiagaraComponent);
+
+	UNiagaraComponent* GetNiagaraComponent() const { return NiagaraComponent; }
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void BeginDestroy() override;
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+
+	// maximum number of points uploaded to the GPU
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 PointBudget;
+
+	// chunks whose angular size (bounds radius / distance) is below this value are not refined
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float MinChunkScreenSize;
+
+	// skip chunks outside of the first player camera frustum
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bFrustumCulling;
+
+	// chunks whose angular size is below this value are not drawn at all (0 disables it)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float CullChunkScreenSize;
+
+	// upload positions as 16 bit unorm texels normalized to the bounds of their chunk instead of 32 bit floats:
+	// the alpha channel is the chunk index, User.ChunkBoundsTexture holds min and size of chunk N in texels 2N and 2N + 1 (rows of User.ChunkBoundsWidth texels).
+	// The niagara system dequantizes with Chunk = round(Texel.a * 65535), Position = Min[Chunk] + Texel.xyz * Size[Chunk];
+	// systems without User.ChunkBoundsTexture (like P_Point_glTFRuntime) get 32 bit float positions
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bQuantizedPositions;
+
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime")
+	int32 GetNumVisiblePoints() const { return NumVisiblePoints; }
+
+	// points removed by frustum/screen size culling in the last selection
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime")
+	int32 GetNumCulledPoints() const { return NumCulledPoints; }
+
+	// points sent to the GPU by the last upload
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime")
+	int32 GetNumUploadedPoints() const { return NumUploadedPoints; }
+
+	// custom attributes are packed 4 per texture: attribute N is in channel N % 4 of User.AttributeTexture<N / 4>
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime")
+	TArray<FString> GetAttributeNames() const;
+
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime")
+	bool GetAttributeChannel(const FString& AttributeName, int32& TextureIndex, int32& Channel, FVector2D& Range) const;
+
+protected:
+	TSharedPtr<FglTFRuntimePointCloudOctree> Octree;
+
+	UPROPERTY()
+	UNiagaraComponent* NiagaraComponent;
+
+	UPROPERTY()
+	UTexture2D* PositionTexture;
+
+	UPROPERTY()
+	UTexture2D* ColorTexture;
+
+	UPROPERTY()
+	TArray<UTexture2D*> AttributeTextures;
+
+	UPROPERTY()
+	UTexture2D* ChunkBoundsTexture;
+
+	int32 TextureWidth;
+	int32 TextureHeight;
+
+	TArray<int32> SelectedChunks;
+	// chunks currently stored in the textures (in texel order)
+	TArray<int32> UploadedChunks;
+	int32 NumVisiblePoints;
+	int32 NumCulledPoints;
+	int32 NumUploadedPoints;
+
+	TSharedPtr<FglTFRuntimePointCloudStagingPool, ESPMode::ThreadSafe> StagingPool;
+
+	void SelectChunks(const FVector& ViewLocation, const FConvexVolume* Frustum, TArray<int32>& OutChunks, int32& OutNumCulledPoints) const;
+	void UploadChunks(const TArray<int32>& Chunks);
+	void UploadChunksBounds();
+	void UploadRows(UTexture2D* Texture, const int32 Width, const int32 BytesPerTexel, const int32 FirstRow, const int32 NumRows, TArray<uint8>&& Staging);
+};